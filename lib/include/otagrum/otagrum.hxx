@@ -26,15 +26,22 @@
 #include "otagrum/NamedDAG.hxx"
 #include "otagrum/NamedJunctionTree.hxx"
 #include "otagrum/ContinuousTTest.hxx"
+#include "otagrum/LearningMonitor.hxx"
 #include "otagrum/ContinuousPC.hxx"
+#include "otagrum/ClusteredContinuousPC.hxx"
 #include "otagrum/CorrectedMutualInformation.hxx"
 #include "otagrum/ContinuousMIIC.hxx"
+#include "otagrum/ContinuousMarkovBlanket.hxx"
 #include "otagrum/TabuList.hxx"
+#include "otagrum/StructureBootstrap.hxx"
 #include "otagrum/JunctionTreeBernsteinCopula.hxx"
 #include "otagrum/JunctionTreeBernsteinCopulaFactory.hxx"
 #include "otagrum/ContinuousBayesianNetwork.hxx"
 #include "otagrum/ContinuousBayesianNetworkFactory.hxx"
 #include "otagrum/StratifiedCache.hxx"
+#include "otagrum/IncrementalReachability.hxx"
+#include "otagrum/EntropyStore.hxx"
+#include "otagrum/RankCorrelationScreening.hxx"
 
 #endif // OTAGRUM_HXX
 
@@ -0,0 +1,404 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ClusteredContinuousPC
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#include <agrum/base/core/hashTable.h>
+
+#include <openturns/DistFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
+
+#include "otagrum/ClusteredContinuousPC.hxx"
+
+#define TRACE(x)                                                               \
+  {                                                                            \
+    if (verbose_)                                                              \
+      std::cout << x;                                                          \
+  }
+
+namespace OTAGRUM
+{
+
+/**
+ * create a clustered learner using PC algorithm with continuous variables
+ *
+ * @param data : the data
+ * @param maxConditioningSetSize : the size max for the conditioning set in a
+ * independence test
+ * @param alpha : the threshold for the independence test
+ */
+ClusteredContinuousPC::ClusteredContinuousPC(
+  const OT::Sample &data, const OT::UnsignedInteger maxConditioningSetSize,
+  const double alpha)
+  : OT::Object(), data_(data), maxCondSet_(maxConditioningSetSize),
+    alpha_(alpha), maxClusterSize_(50), overlapSize_(5), verbose_(false),
+    merged_(false)
+{
+}
+
+void ClusteredContinuousPC::setMaximumClusterSize(
+  const OT::UnsignedInteger maximumClusterSize)
+{
+  if (maximumClusterSize < 2)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the maximum cluster size must be at least 2, got "
+        << maximumClusterSize;
+  maxClusterSize_ = maximumClusterSize;
+  merged_ = false;
+}
+
+OT::UnsignedInteger ClusteredContinuousPC::getMaximumClusterSize() const
+{
+  return maxClusterSize_;
+}
+
+void ClusteredContinuousPC::setOverlapSize(const OT::UnsignedInteger overlapSize)
+{
+  overlapSize_ = overlapSize;
+  merged_ = false;
+}
+
+OT::UnsignedInteger ClusteredContinuousPC::getOverlapSize() const
+{
+  return overlapSize_;
+}
+
+// p-value of the nullity of the Spearman correlation (Fisher transform)
+double ClusteredContinuousPC::getCorrelationPValue(const OT::UnsignedInteger x,
+    const OT::UnsignedInteger y) const
+{
+  const double rho = std::min(std::abs(spearman_(x, y)), 1.0 - 1e-12);
+  const double z = std::atanh(rho) * std::sqrt(data_.getSize() - 3.0);
+  return 2.0 * OT::DistFunc::pNormal(-z);
+}
+
+/**
+ * The core clusters gather the variables by decreasing Spearman correlation
+ * (single linkage), as long as the correlation is significant and the
+ * clusters are not larger than maxClusterSize_. Each cluster is then extended
+ * by the overlapSize_ variables outside it the most correlated with one of its
+ * members, so that the edges between clusters are also learned by the PC
+ * algorithm with their neighbours.
+ */
+void ClusteredContinuousPC::buildClusters()
+{
+  const OT::UnsignedInteger dimension = data_.getDimension();
+  spearman_ = data_.computeSpearmanCorrelation();
+
+  std::vector<std::pair<double, gum::Edge>> pairs;
+  for (OT::UnsignedInteger i = 0; i < dimension; ++i)
+    for (OT::UnsignedInteger j = 0; j < i; ++j)
+      if (getCorrelationPValue(i, j) < alpha_)
+        pairs.emplace_back(std::abs(spearman_(i, j)), gum::Edge(i, j));
+  std::stable_sort(pairs.begin(), pairs.end(),
+                   [](const std::pair<double, gum::Edge> &a,
+                      const std::pair<double, gum::Edge> &b)
+  {
+    return a.first > b.first;
+  });
+
+  // union-find with the size of the clusters
+  std::vector<OT::UnsignedInteger> parent(dimension);
+  std::vector<OT::UnsignedInteger> size(dimension, 1);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto root = [&parent](OT::UnsignedInteger x)
+  {
+    while (parent[x] != x)
+    {
+      parent[x] = parent[parent[x]];
+      x = parent[x];
+    }
+    return x;
+  };
+  for (const auto &pair : pairs)
+  {
+    const auto rx = root(pair.second.first());
+    const auto ry = root(pair.second.second());
+    if ((rx != ry) && (size[rx] + size[ry] <= maxClusterSize_))
+    {
+      parent[ry] = rx;
+      size[rx] += size[ry];
+    }
+  }
+
+  gum::HashTable<OT::UnsignedInteger, OT::UnsignedInteger> clusterOf;
+  clusters_.clear();
+  for (OT::UnsignedInteger x = 0; x < dimension; ++x)
+  {
+    const auto r = root(x);
+    if (!clusterOf.exists(r))
+    {
+      clusterOf.insert(r, clusters_.size());
+      clusters_.push_back(OT::Indices());
+    }
+    clusters_[clusterOf[r]].add(x);
+  }
+
+  // overlap
+  for (auto &cluster : clusters_)
+  {
+    std::vector<std::pair<double, OT::UnsignedInteger>> outside;
+    for (OT::UnsignedInteger y = 0; y < dimension; ++y)
+    {
+      if (cluster.contains(y))
+        continue;
+      double best = 0.0;
+      bool significant = false;
+      for (const auto x : cluster)
+      {
+        if (getCorrelationPValue(x, y) < alpha_)
+          significant = true;
+        best = std::max(best, std::abs(spearman_(x, y)));
+      }
+      if (significant)
+        outside.emplace_back(best, y);
+    }
+    std::stable_sort(outside.begin(), outside.end(),
+                     [](const std::pair<double, OT::UnsignedInteger> &a,
+                        const std::pair<double, OT::UnsignedInteger> &b)
+    {
+      return a.first > b.first;
+    });
+    for (OT::UnsignedInteger i = 0; i < std::min<OT::UnsignedInteger>(overlapSize_, outside.size()); ++i)
+      cluster.add(outside[i].second);
+    std::sort(cluster.begin(), cluster.end());
+  }
+  TRACE("== " << clusters_.size() << " clusters" << std::endl);
+}
+
+void ClusteredContinuousPC::learnCluster(const OT::UnsignedInteger i,
+    ClusterResult &result) const
+{
+  const auto &cluster = clusters_[i];
+  if (cluster.getSize() < 2)
+    return;
+  ContinuousPC learner(data_.getMarginal(cluster), maxCondSet_, alpha_);
+  const auto skeleton = learner.learnSkeleton();
+  for (gum::NodeId x = 0; x < cluster.getSize(); ++x)
+    for (gum::NodeId y = 0; y < x; ++y)
+    {
+      const gum::Edge global(cluster[x], cluster[y]);
+      if (skeleton.existsEdge(x, y))
+      {
+        result.kept.push_back(global);
+        // no test at all without conditioning set
+        result.keptPValues.push_back(maxCondSet_ > 0 ? learner.getPValue(x, y) : 0.0);
+        continue;
+      }
+      OT::Indices sepset;
+      for (const auto s : learner.getSepset(x, y))
+        sepset.add(cluster[s]);
+      result.removed.push_back(global);
+      result.sepsets.push_back(sepset);
+      result.pvalues.push_back(learner.getPValue(x, y));
+    }
+}
+
+struct ClusteredContinuousPCPolicy
+{
+  const ClusteredContinuousPC &learner_;
+  std::vector<ClusteredContinuousPC::ClusterResult> &results_;
+
+  ClusteredContinuousPCPolicy(const ClusteredContinuousPC &learner,
+                              std::vector<ClusteredContinuousPC::ClusterResult> &results)
+    : learner_(learner), results_(results)
+  {
+  }
+
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger i = r.begin(); i != r.end(); ++i)
+      learner_.learnCluster(i, results_[i]);
+  }
+};
+
+/**
+ * Learn the clusters in parallel and merge their skeletons : an edge is kept
+ * if no cluster containing its two nodes removed it (the separator with the
+ * largest p-value is kept otherwise). The pairs never in the same cluster are
+ * kept if their Spearman correlation is significant. The merged skeleton is
+ * then checked by the PC algorithm on the whole data, starting from it : only
+ * the edges near the overlaps and the edges between clusters are tested
+ * again, the other ones have the same neighbours as in their cluster.
+ */
+void ClusteredContinuousPC::mergeClusters()
+{
+  buildClusters();
+  std::vector<ClusterResult> results(clusters_.size());
+  const ClusteredContinuousPCPolicy policy(*this, results);
+  OT::TBBImplementation::ParallelFor(0, clusters_.size(), policy);
+
+  const OT::UnsignedInteger dimension = data_.getDimension();
+  gum::EdgeProperty<double> kept;
+  gum::EdgeProperty<OT::Indices> sepsets;
+  gum::EdgeProperty<double> pvalues;
+  for (const auto &result : results)
+  {
+    for (OT::UnsignedInteger i = 0; i < result.kept.size(); ++i)
+    {
+      const auto &edge = result.kept[i];
+      kept.set(edge, std::max(kept.getWithDefault(edge, 0.0),
+                              result.keptPValues[i]));
+    }
+    for (OT::UnsignedInteger i = 0; i < result.removed.size(); ++i)
+    {
+      const auto &edge = result.removed[i];
+      if (!pvalues.exists(edge) || (result.pvalues[i] > pvalues[edge]))
+      {
+        sepsets.set(edge, result.sepsets[i]);
+        pvalues.set(edge, result.pvalues[i]);
+      }
+    }
+  }
+
+  gum::UndiGraph skeleton;
+  for (gum::NodeId x = 0; x < dimension; ++x)
+    skeleton.addNodeWithId(x);
+  // the nodes whose neighbours may differ from the ones in their cluster :
+  // the nodes of the overlaps and of the edges between clusters
+  std::vector<OT::UnsignedInteger> membership(dimension, 0);
+  for (const auto &cluster : clusters_)
+    for (const auto x : cluster)
+      ++membership[x];
+  gum::NodeSet touched;
+  for (gum::NodeId x = 0; x < dimension; ++x)
+    if (membership[x] > 1)
+      touched.insert(x);
+  OT::UnsignedInteger crossing = 0;
+  for (gum::NodeId x = 0; x < dimension; ++x)
+    for (gum::NodeId y = 0; y < x; ++y)
+    {
+      const gum::Edge edge(x, y);
+      if (pvalues.exists(edge))
+        continue;
+      if (kept.exists(edge))
+        skeleton.addEdge(x, y);
+      else
+      {
+        // never in the same cluster
+        const double p = getCorrelationPValue(x, y);
+        if (p < alpha_)
+        {
+          skeleton.addEdge(x, y);
+          touched.insert(x);
+          touched.insert(y);
+          ++crossing;
+        }
+        else
+        {
+          sepsets.set(edge, OT::Indices());
+          pvalues.set(edge, p);
+        }
+      }
+    }
+  TRACE("== merged skeleton : " << skeleton.sizeEdges() << " edges, "
+        << crossing << " between clusters" << std::endl);
+
+  // the learner is only built for the final check, as it ranks the data again
+  pc_ = std::make_shared<ContinuousPC>(data_, maxCondSet_, alpha_);
+  pc_->setVerbosity(verbose_);
+  pc_->setInitialSkeleton(skeleton);
+  for (auto iter = sepsets.cbegin(); iter != sepsets.cend(); ++iter)
+    pc_->setInitialSepset(iter.key().first(), iter.key().second(), iter.val(),
+                         pvalues[iter.key()]);
+  // the other edges have the neighbours of their cluster, where they passed
+  // all the tests
+  OT::UnsignedInteger frozen = 0;
+  for (auto iter = kept.cbegin(); iter != kept.cend(); ++iter)
+  {
+    const auto &edge = iter.key();
+    if (!skeleton.existsEdge(edge) || touched.contains(edge.first()) ||
+        touched.contains(edge.second()))
+      continue;
+    pc_->addFrozenEdge(edge.first(), edge.second(), iter.val());
+    ++frozen;
+  }
+  TRACE("== " << skeleton.sizeEdges() - frozen << " edges to check"
+        << std::endl);
+  merged_ = true;
+}
+
+gum::UndiGraph ClusteredContinuousPC::learnSkeleton()
+{
+  if (!merged_)
+    mergeClusters();
+  return pc_->learnSkeleton();
+}
+
+gum::MixedGraph ClusteredContinuousPC::learnPDAG()
+{
+  if (!merged_)
+    mergeClusters();
+  return pc_->learnPDAG();
+}
+
+NamedJunctionTree ClusteredContinuousPC::learnJunctionTree()
+{
+  if (!merged_)
+    mergeClusters();
+  return pc_->learnJunctionTree();
+}
+
+NamedDAG ClusteredContinuousPC::learnDAG()
+{
+  if (!merged_)
+    mergeClusters();
+  return pc_->learnDAG();
+}
+
+OT::UnsignedInteger ClusteredContinuousPC::getClustersNumber() const
+{
+  return clusters_.size();
+}
+
+OT::Indices ClusteredContinuousPC::getCluster(const OT::UnsignedInteger i) const
+{
+  if (i >= clusters_.size())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: no cluster " << i << ", there are " << clusters_.size();
+  return clusters_[i];
+}
+
+ContinuousPC ClusteredContinuousPC::getContinuousPC() const
+{
+  if (!pc_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the merged skeleton has not been learned yet";
+  return *pc_;
+}
+
+void ClusteredContinuousPC::setVerbosity(bool verbose)
+{
+  verbose_ = verbose;
+  if (pc_)
+    pc_->setVerbosity(verbose);
+}
+
+bool ClusteredContinuousPC::getVerbosity() const
+{
+  return verbose_;
+}
+
+} // namespace OTAGRUM
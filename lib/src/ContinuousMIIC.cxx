@@ -19,11 +19,21 @@
  *
  */
 
+#include <cstdio>
+#include <fstream>
+#include <map>
+
 #include <agrum/base/core/list.h>
+#include <agrum/base/core/priorityQueue.h>
 #include <agrum/base/graphs/algorithms/MeekRules.h>
 //#include <chrono>
 
+#include <openturns/ResourceMap.hxx>
+#include <openturns/TBBImplementation.hxx>
+
 #include "otagrum/ContinuousMIIC.hxx"
+#include "otagrum/IncrementalReachability.hxx"
+#include "otagrum/RankCorrelationScreening.hxx"
 #include "otagrum/Greater.hxx"
 
 #define TRACE(x)                                                               \
@@ -54,6 +64,7 @@ namespace OTAGRUM
 
 ContinuousMIIC::ContinuousMIIC(const OT::Sample &data)
   : OT::Object()
+  , data_(data)
   , info_(data)
 {
   // Complete unoriented graph
@@ -67,12 +78,33 @@ ContinuousMIIC::ContinuousMIIC(const OT::Sample &data)
   }
 }
 
+/**
+ * Resume the run that wrote checkpointFile (see setCheckpointFile) : the
+ * settings, the constraints and the state of the iteration phase are read
+ * from the file, and learnSkeleton continues the iteration phase, giving the
+ * same results as the uninterrupted run.
+ */
+ContinuousMIIC::ContinuousMIIC(const OT::Sample &data,
+                               const std::string &checkpointFile)
+  : ContinuousMIIC(data)
+{
+  readCheckpoint(checkpointFile);
+}
+
 gum::UndiGraph ContinuousMIIC::learnSkeleton()
 {
   // clear the vector of latents arcs to be sure
   latent_couples_.clear();
+  control_.start();
+  testsNumber_ = 0;
 
-  initiation();
+  if (resumed_)
+  {
+    TRACE("\n===== RESUMING ITERATION =====" << std::endl);
+    resumed_ = false;
+  }
+  else
+    initiation();
   iteration();
 
   skeleton_done_ = true;
@@ -90,6 +122,26 @@ void ContinuousMIIC::setKMode(CorrectedMutualInformation::KModeTypes kmode)
   info_.setKMode(kmode);
 }
 
+void ContinuousMIIC::setRankScreening(const bool rankScreening)
+{
+  rankScreening_ = rankScreening;
+}
+
+bool ContinuousMIIC::getRankScreening() const
+{
+  return rankScreening_;
+}
+
+void ContinuousMIIC::setEntropyTolerance(const double entropyTolerance)
+{
+  info_.setEntropyTolerance(entropyTolerance);
+}
+
+double ContinuousMIIC::getEntropyTolerance() const
+{
+  return info_.getEntropyTolerance();
+}
+
 void ContinuousMIIC::setVerbosity(bool verbose)
 {
   verbose_ = verbose;
@@ -105,11 +157,231 @@ void ContinuousMIIC::setAlpha(double alpha)
   info_.setAlpha(alpha);
 }
 
+void ContinuousMIIC::setMonitor(LearningMonitor *monitor)
+{
+  control_.setMonitor(monitor);
+}
+
+void ContinuousMIIC::setMaximumWallTime(const double maximumWallTime)
+{
+  control_.setMaximumWallTime(maximumWallTime);
+}
+
+double ContinuousMIIC::getMaximumWallTime() const
+{
+  return control_.getMaximumWallTime();
+}
+
+bool ContinuousMIIC::isInterrupted() const
+{
+  return control_.isInterrupted();
+}
+
 double ContinuousMIIC::getAlpha() const
 {
   return info_.getAlpha();
 }
 
+void ContinuousMIIC::setNeighbourContributors(const bool neighbourContributors)
+{
+  neighbourContributors_ = neighbourContributors;
+}
+
+bool ContinuousMIIC::getNeighbourContributors() const
+{
+  return neighbourContributors_;
+}
+
+void ContinuousMIIC::setContributorsNumber(const OT::UnsignedInteger contributorsNumber)
+{
+  contributorsNumber_ = contributorsNumber;
+}
+
+OT::UnsignedInteger ContinuousMIIC::getContributorsNumber() const
+{
+  return contributorsNumber_;
+}
+
+void ContinuousMIIC::setCheckpointFile(const std::string &fileName,
+                                       const bool withCache)
+{
+  checkpointFile_ = fileName;
+  checkpointCache_ = withCache;
+}
+
+std::string ContinuousMIIC::getCheckpointFile() const
+{
+  return checkpointFile_;
+}
+
+/**
+ * Write the state of the iteration phase, before the next pop of rank_. The
+ * heap is written in the order of its internal array, so that inserting its
+ * elements in this order rebuilds the same heap (ties included). The file is
+ * first written under a temporary name and then renamed.
+ */
+void ContinuousMIIC::writeCheckpoint() const
+{
+  const std::string tmpFile = checkpointFile_ + ".tmp";
+  {
+    std::ofstream os(tmpFile);
+    if (!os)
+      throw OT::FileOpenException(HERE)
+          << "Error: cannot write the checkpoint file " << tmpFile;
+    os.precision(17);
+    os << "ContinuousMIIC-checkpoint 1" << std::endl;
+    os << "data " << info_.getDimension() << ' ' << info_.getSize()
+       << std::endl;
+    os << "settings " << info_.getAlpha() << ' '
+       << static_cast<int>(info_.getCMode()) << ' '
+       << static_cast<int>(info_.getKMode()) << std::endl;
+
+    os << "marks " << initial_marks_.size() << std::endl;
+    for (auto iter = initial_marks_.cbegin(); iter != initial_marks_.cend();
+         ++iter)
+      os << iter.key().first << ' ' << iter.key().second << ' ' << iter.val()
+         << std::endl;
+
+    os << "edges " << skeleton_.sizeEdges() << std::endl;
+    for (const auto &edge : skeleton_.edges())
+      os << edge.first() << ' ' << edge.second() << std::endl;
+
+    os << "sepsets " << sepset_.size() << std::endl;
+    for (auto iter = sepset_.cbegin(); iter != sepset_.cend(); ++iter)
+    {
+      os << iter.key().first() << ' ' << iter.key().second() << ' '
+         << iter.val().getSize();
+      for (const auto x : iter.val())
+        os << ' ' << x;
+      os << std::endl;
+    }
+
+    os << "rank " << rank_.size() << std::endl;
+    for (gum::Size i = 0; i < rank_.size(); ++i)
+    {
+      const auto &elt = rank_[i];
+      os << elt.X << ' ' << elt.Y << ' ' << elt.Z << ' ' << elt.score << ' '
+         << elt.U.getSize();
+      for (const auto x : elt.U)
+        os << ' ' << x;
+      os << std::endl;
+    }
+
+    if (checkpointCache_)
+    {
+      os << "cache ";
+      info_.writeCaches(os);
+    }
+    else
+      os << "cache 0" << std::endl;
+
+    if (!os)
+      throw OT::FileOpenException(HERE)
+          << "Error: cannot write the checkpoint file " << tmpFile;
+  }
+  if (std::rename(tmpFile.c_str(), checkpointFile_.c_str()) != 0)
+    throw OT::FileOpenException(HERE)
+        << "Error: cannot write the checkpoint file " << checkpointFile_;
+}
+
+// reads the word expected, and then a count
+static OT::UnsignedInteger ReadSection(std::istream &is,
+                                       const std::string &expected)
+{
+  std::string word;
+  OT::UnsignedInteger count = 0;
+  is >> word >> count;
+  if (!is || (word != expected))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: invalid checkpoint file, expected section " << expected;
+  return count;
+}
+
+void ContinuousMIIC::readCheckpoint(const std::string &fileName)
+{
+  std::ifstream is(fileName);
+  if (!is)
+    throw OT::FileNotFoundException(HERE)
+        << "Error: cannot read the checkpoint file " << fileName;
+
+  std::string word;
+  int version = 0;
+  is >> word >> version;
+  if (word != "ContinuousMIIC-checkpoint" || version != 1)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << fileName << " is not a ContinuousMIIC checkpoint file";
+
+  OT::UnsignedInteger dimension = 0, size = 0;
+  is >> word >> dimension >> size;
+  if ((dimension != info_.getDimension()) || (size != info_.getSize()))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the checkpoint has been written for data of dimension "
+        << dimension << " and size " << size << ", got "
+        << info_.getDimension() << " and " << info_.getSize();
+
+  double alpha = 0.0;
+  int cmode = 0, kmode = 0;
+  is >> word >> alpha >> cmode >> kmode;
+  info_.setCMode(static_cast<CorrectedMutualInformation::CModeTypes>(cmode));
+  info_.setKMode(static_cast<CorrectedMutualInformation::KModeTypes>(kmode));
+  info_.setAlpha(alpha);
+
+  initial_marks_.clear();
+  const auto marks = ReadSection(is, "marks");
+  for (OT::UnsignedInteger i = 0; i < marks; ++i)
+  {
+    gum::NodeId x = 0, y = 0;
+    char mark = ' ';
+    is >> x >> y >> mark;
+    initial_marks_.insert({x, y}, mark);
+  }
+
+  skeleton_.clearEdges();
+  const auto edges = ReadSection(is, "edges");
+  for (OT::UnsignedInteger i = 0; i < edges; ++i)
+  {
+    gum::NodeId x = 0, y = 0;
+    is >> x >> y;
+    skeleton_.addEdge(x, y);
+  }
+
+  sepset_.clear();
+  const auto sepsets = ReadSection(is, "sepsets");
+  for (OT::UnsignedInteger i = 0; i < sepsets; ++i)
+  {
+    gum::NodeId x = 0, y = 0;
+    OT::UnsignedInteger sepSize = 0;
+    is >> x >> y >> sepSize;
+    OT::Indices sep(sepSize);
+    for (OT::UnsignedInteger j = 0; j < sepSize; ++j)
+      is >> sep[j];
+    sepset_.insert(gum::Edge(x, y), sep);
+  }
+
+  const auto ranks = ReadSection(is, "rank");
+  for (OT::UnsignedInteger i = 0; i < ranks; ++i)
+  {
+    ContributorRecord record;
+    OT::UnsignedInteger USize = 0;
+    is >> record.X >> record.Y >> record.Z >> record.score >> USize;
+    record.U = OT::Indices(USize);
+    for (OT::UnsignedInteger j = 0; j < USize; ++j)
+      is >> record.U[j];
+    rank_.insert(record);
+  }
+
+  is >> word;
+  if (!is || (word != "cache"))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: invalid checkpoint file, expected section cache";
+  info_.readCaches(is);
+
+  if (!is)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: cannot read the checkpoint file " << fileName;
+  resumed_ = true;
+}
+
 std::vector< gum::Arc > ContinuousMIIC::getLatentVariables() const
 {
   return latent_couples_;
@@ -149,40 +421,114 @@ void ContinuousMIIC::addMandatoryArc(OT::UnsignedInteger head, OT::UnsignedInteg
   initial_marks_.insert({head, tail}, '>');
 }
 
+struct ContinuousMIIC::InitiationPolicy
+{
+  // evaluation of an edge of the complete graph
+  struct Result
+  {
+    double IXY = 0.0;
+    double standardError = 0.0;
+    OT::UnsignedInteger Z = 0;
+    double P = -1.0;
+    OT::UnsignedInteger testsNumber = 0;
+  };
+
+  const ContinuousMIIC &miic_;
+  const std::vector<gum::Edge> &edges_;
+  const OT::UnsignedInteger start_;
+  std::vector<CorrectedMutualInformation> &infos_;
+  std::vector<Result> &results_;
+
+  InitiationPolicy(const ContinuousMIIC &miic,
+                   const std::vector<gum::Edge> &edges,
+                   const OT::UnsignedInteger start,
+                   std::vector<CorrectedMutualInformation> &infos,
+                   std::vector<Result> &results)
+    : miic_(miic), edges_(edges), start_(start), infos_(infos), results_(results)
+  {
+  }
+
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger i = r.begin(); i != r.end(); ++i)
+    {
+      const gum::Edge &edge = edges_[start_ + i];
+      Result &result = results_[i];
+      result.IXY = infos_[i].compute2PtCorrectedInformation(edge.first(), edge.second());
+      result.standardError = infos_[i].getInformationStandardError();
+      if (result.IXY > 0)
+        std::tie(result.Z, result.P, result.testsNumber) =
+          miic_.computeBestContributor(infos_[i], edge.first(), edge.second(), OT::Indices());
+    }
+  }
+};
+
+// the edges are evaluated in parallel by batches, each with a local entropy
+// cache, then merged in the order of the serial loop so that sepset_, rank_
+// and the cache get the same content
 void ContinuousMIIC::initiation()
 {
   unsigned int cutted_edges = 0;
   //auto start_initiation = std::chrono::steady_clock::now();
   TRACE("\n===== STARTING INITIATION =====" << std::endl);
-  OT::UnsignedInteger  X, Y;
-  gum::EdgeSet edges = skeleton_.edges();
-
-  //std::vector< double > times;
-  for (const auto &edge : edges)
+  // the edges whose rank correlation is negligible are cut without test
+  gum::UndiGraph screened;
+  if (rankScreening_)
+    screened = RankCorrelationScreening(data_).computeSkeleton();
+  std::vector<gum::Edge> edges;
+  std::vector<gum::Edge> screenedOut;
+  for (const auto &edge : skeleton_.edges())
   {
-    //auto start = std::chrono::steady_clock::now();
-    X = edge.first();
-    Y = edge.second();
-    TRACE("\t\n\nEdge: " << edge << std::endl);
-    double IXY = info_.compute2PtCorrectedInformation(X, Y);
-    TRACE("\tI(" << X << "," << Y << ") = " << IXY << std::endl);
-
-    if (IXY <= 0)     //< K
-    {
-      skeleton_.eraseEdge(edge);
-      cutted_edges++;
-      TRACE("\tCutting edge " << edge << std::endl);
-      sepset_.insert(edge, OT::Indices());
-    }
+    if (rankScreening_ && !screened.existsEdge(edge))
+      screenedOut.push_back(edge);
     else
+      edges.push_back(edge);
+  }
+  for (const auto &edge : screenedOut)
+  {
+    skeleton_.eraseEdge(edge);
+    cutted_edges++;
+    TRACE("\tScreening out edge " << edge << std::endl);
+    sepset_.insert(edge, OT::Indices());
+  }
+  const OT::UnsignedInteger batchSize = std::max<OT::UnsignedInteger>(1,
+                                        OT::ResourceMap::GetAsUnsignedInteger("ContinuousMIIC-InitiationBatchSize"));
+
+  for (OT::UnsignedInteger start = 0; start < edges.size(); start += batchSize)
+  {
+    // the edges not examined yet are kept, without contributor
+    if (control_.report("initiation", 0, edges.size() - start, testsNumber_))
+      break;
+    const OT::UnsignedInteger size = std::min<OT::UnsignedInteger>(batchSize, edges.size() - start);
+    std::vector<CorrectedMutualInformation> infos(size, info_.getLocalCopy());
+    std::vector<InitiationPolicy::Result> results(size);
+    const InitiationPolicy policy(*this, edges, start, infos, results);
+    OT::TBBImplementation::ParallelFor(0, size, policy);
+
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
     {
-      findBestContributor(X, Y, OT::Indices());
+      const gum::Edge &edge = edges[start + i];
+      const InitiationPolicy::Result &result = results[i];
+      ++testsNumber_;
+      TRACE("\t\n\nEdge: " << edge << std::endl);
+      TRACE("\tI(" << edge.first() << "," << edge.second() << ") = " << result.IXY << std::endl);
+      if (info_.getEntropyTolerance() > 0.0)
+        TRACE("\tStandard error: " << result.standardError << std::endl);
+      if (result.IXY <= 0)     //< K
+      {
+        skeleton_.eraseEdge(edge);
+        cutted_edges++;
+        TRACE("\tCutting edge " << edge << std::endl);
+        sepset_.insert(edge, OT::Indices());
+      }
+      else
+      {
+        testsNumber_ += result.testsNumber;
+        insertContributor(edge.first(), edge.second(), result.Z, OT::Indices(), result.P);
+      }
+      info_.mergeCaches(infos[i]);
     }
-    //auto end = std::chrono::steady_clock::now();
-    //std::chrono::duration<double> diff = end - start;
-    //times.push_back(diff.count());
-    //TRACE("\tElapsed time for this edge: " << diff.count() << " s" << std::endl);
-
   }
   TRACE("===== ENDING INITIATION =====" << std::endl);
   //auto end_initiation = std::chrono::steady_clock::now();
@@ -199,25 +545,27 @@ void ContinuousMIIC::iteration()
   //auto start_iteration = std::chrono::steady_clock::now();
   TRACE("\n===== STARTING ITERATION =====" << std::endl);
   // if no triples to further examine pass
-  std::pair< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::Indices >*,
-      double > best;
-
   //std::vector< double > times;
   unsigned int n_iterations = 0;
-  while (!rank_.empty() && rank_.top().second > 0.5)
+  const OT::UnsignedInteger checkpointPeriod = std::max<OT::UnsignedInteger>(1,
+      OT::ResourceMap::GetAsUnsignedInteger("ContinuousMIIC-CheckpointPeriod"));
+  while (!rank_.empty() && rank_.top().score > 0.5)
   {
+    if (!checkpointFile_.empty() && (n_iterations % checkpointPeriod == 0))
+      writeCheckpoint();
+    // the edges still in the heap are kept
+    if (control_.report("iteration", n_iterations, rank_.size(), testsNumber_))
+      break;
     n_iterations++;
+    ++testsNumber_;
     //auto start = std::chrono::steady_clock::now();
-    best = rank_.pop();
+    ContributorRecord best = rank_.pop();
 
-    const OT::UnsignedInteger X = std::get< 0 >(*(best.first));
-    const OT::UnsignedInteger Y = std::get< 1 >(*(best.first));
-    const OT::UnsignedInteger Z = std::get< 2 >(*(best.first));
-    OT::Indices U = std::move(std::get< 3 >(*(best.first)));
-    double proba = best.second;
+    const OT::UnsignedInteger X = best.X;
+    const OT::UnsignedInteger Y = best.Y;
+    const OT::UnsignedInteger Z = best.Z;
+    OT::Indices U = std::move(best.U);
+    double proba = best.score;
 
     TRACE("\n\t((" << X << ", " << Y << ", " << Z << ", " << U << "), "
           << proba << ")" << std::endl);
@@ -225,6 +573,8 @@ void ContinuousMIIC::iteration()
     U.add(Z);
     const double IXY_U = info_.compute2PtCorrectedInformation(X, Y, U);
     TRACE("\t\tI(" << X << "; " << Y << " | " << U << ") = " << IXY_U << std::endl);
+    if (info_.getEntropyTolerance() > 0.0)
+      TRACE("\t\tStandard error: " << info_.getInformationStandardError() << std::endl);
     if (IXY_U < 0)
     {
       skeleton_.eraseEdge(gum::Edge(X, Y));
@@ -238,18 +588,14 @@ void ContinuousMIIC::iteration()
       findBestContributor(X, Y, U);
     }
 
-    delete best.first;
     //auto end = std::chrono::steady_clock::now();
     //std::chrono::duration<double> diff = end - start;
     //times.push_back(diff.count());
     //TRACE("\tElapsed time for this iteration: " << diff.count() << " s" << std::endl);
   }
-  // clean up remaining heap-allocated tuples in rank_
+  // the edges left in the heap are kept
   while (!rank_.empty())
-  {
-    auto remaining = rank_.pop();
-    delete remaining.first;
-  }
+    rank_.pop();
   TRACE("===== ENDING ITERATION =====" << std::endl);
   TRACE("Summary:" << std::endl);
   //auto end_iteration = std::chrono::steady_clock::now();
@@ -260,48 +606,48 @@ void ContinuousMIIC::iteration()
   TRACE("\tNumber of cutted edges: " << cutted_edges << std::endl << std::endl);
 }
 
-void ContinuousMIIC::propagatesHead(gum::MixedGraph& graph, gum::NodeId node)
+void ContinuousMIIC::propagatesHead(gum::NodeId node)
 {
-  const auto neighbours = graph.neighbours(node);
+  const auto neighbours = pdag_.neighbours(node);
   TRACE("\tNode: " << node << std::endl);
   TRACE("\t\tNeighbours: " << neighbours << std::endl);
   for (const auto& neighbour : neighbours)
   {
-    if (graph.neighbours(neighbour).contains(node))
+    if (pdag_.neighbours(neighbour).contains(node))
     {
-      if (!existsDirectedPath(graph, neighbour, node)
+      if (!existsDirectedPath(neighbour, node)
           && !(initial_marks_.exists({node, neighbour})
                && initial_marks_[ {node, neighbour}] == '-')
-          && graph.parents(neighbour).empty())
+          && pdag_.parents(neighbour).empty())
       {
-        graph.eraseEdge(gum::Edge(neighbour, node));
-        graph.addArc(node, neighbour);
+        pdag_.eraseEdge(gum::Edge(neighbour, node));
+        addPDAGArc(node, neighbour);
         TRACE("\t\t1. Removing edge (" << neighbour << "," << node << ")"
               << std::endl);
         TRACE("\t\t1. Adding arc (" << node << "," << neighbour << ")"
               << std::endl);
-        propagatesHead(graph, neighbour);
+        propagatesHead(neighbour);
       }
-      else if (!existsDirectedPath(graph, node, neighbour)
+      else if (!existsDirectedPath(node, neighbour)
                && !(initial_marks_.exists({neighbour, node})
                     && initial_marks_[ {neighbour, node}] == '-')
-               && graph.parents(node).empty())
+               && pdag_.parents(node).empty())
       {
-        graph.eraseEdge(gum::Edge(neighbour, node));
-        graph.addArc(neighbour, node);
+        pdag_.eraseEdge(gum::Edge(neighbour, node));
+        addPDAGArc(neighbour, node);
         TRACE("\t\t2. Removing edge (" << neighbour << "," << node << ")"
               << std::endl);
         TRACE("\t\t2. Adding arc (" << neighbour << "," << node << ")"
               << std::endl);
       }
-      else if (!existsDirectedPath(graph, node, neighbour)
+      else if (!existsDirectedPath(node, neighbour)
                && !(initial_marks_.exists({neighbour, node})
                     && initial_marks_[ {neighbour, node}] == '-'))
       {
-        graph.eraseEdge(gum::Edge(neighbour, node));
-        graph.addArc(neighbour, node);
-        if (!graph.parents(neighbour).empty()
-            && !graph.parents(node).empty())
+        pdag_.eraseEdge(gum::Edge(neighbour, node));
+        addPDAGArc(neighbour, node);
+        if (!pdag_.parents(neighbour).empty()
+            && !pdag_.parents(node).empty())
         {
           latent_couples_.push_back(gum::Arc(node, neighbour));
         }
@@ -311,14 +657,14 @@ void ContinuousMIIC::propagatesHead(gum::MixedGraph& graph, gum::NodeId node)
         TRACE("\t\t3. Adding arc (" << neighbour << "," << node << ")"
               << std::endl);
       }
-      else if (!existsDirectedPath(graph, neighbour, node)
+      else if (!existsDirectedPath(neighbour, node)
                && !(initial_marks_.exists({node, neighbour})
                     && initial_marks_[ {node, neighbour}] == '-'))
       {
-        graph.eraseEdge(gum::Edge(node, neighbour));
-        graph.addArc(node, neighbour);
-        if (!graph.parents(neighbour).empty()
-            && !graph.parents(node).empty())
+        pdag_.eraseEdge(gum::Edge(node, neighbour));
+        addPDAGArc(node, neighbour);
+        if (!pdag_.parents(neighbour).empty()
+            && !pdag_.parents(node).empty())
         {
           latent_couples_.push_back(gum::Arc(node, neighbour));
         }
@@ -335,7 +681,7 @@ void ContinuousMIIC::propagatesHead(gum::MixedGraph& graph, gum::NodeId node)
       //}
       else
       {
-        graph.eraseEdge(gum::Edge(neighbour, node));
+        pdag_.eraseEdge(gum::Edge(neighbour, node));
         TRACE("\t\t5. Removing edge (" << neighbour << "," << node << ")"
               << std::endl);
       }
@@ -373,6 +719,8 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
   {
     learnSkeleton();
   }
+  else
+    control_.start();
   pdag_ = UGtoMG(skeleton_);
 
   // structure to store the orientations marks -, o, or >,
@@ -381,7 +729,9 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
 
   // marks always correspond to the head of the arc/edge. - is for a forbidden
   // arc, > for a mandatory arc
-  // we start by adding the mandatory arcs
+  // we start by adding the mandatory arcs, whose triples are updated after
+  // the first orientation as the other changed arcs
+  changedArcs_.clear();
   for (auto iter = marks.begin(); iter != marks.end(); ++iter)
   {
     if (pdag_.existsEdge(iter.key().first, iter.key().second)
@@ -389,48 +739,53 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
     {
       pdag_.eraseEdge(gum::Edge(iter.key().first, iter.key().second));
       pdag_.addArc(iter.key().first, iter.key().second);
+      changedArcs_.push_back(gum::Arc(iter.key().first, iter.key().second));
     }
   }
 
-  std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger >*,
-      double,
-      double,
-      double > >
-      proba_triples = getUnshieldedTriples(pdag_, marks);
+  // the directed paths of pdag_ are maintained along its orientation
+  reachability_ = IncrementalReachability(pdag_);
 
+  std::vector< TripleRecord > triples = getUnshieldedTriples(pdag_, marks);
 
-  std::tuple< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger >*, double, double, double >
-      best;
-
-  if (!proba_triples.empty())
+  // the triples ordered by GreaterTriple, updated in place when their arcs
+  // change, and the triples of each edge X-Z or Y-Z
+  gum::PriorityQueue< OT::UnsignedInteger, TripleRecord, GreaterTriple > queue;
+  gum::EdgeProperty< std::vector< OT::UnsignedInteger > > edgeTriples;
+  for (const auto &triple : triples)
   {
-    best = proba_triples[0];
+    queue.insert(triple.index, triple);
+    for (const auto &edge : {gum::Edge(triple.X, triple.Z), gum::Edge(triple.Y, triple.Z)})
+    {
+      if (!edgeTriples.exists(edge))
+        edgeTriples.insert(edge, std::vector< OT::UnsignedInteger >());
+      edgeTriples[edge].push_back(triple.index);
+    }
   }
 
-  while (!proba_triples.empty()
-         && std::max(std::get< 2 >(best), std::get< 3 >(best)) > 0.5)
+  while (!queue.empty()
+         && std::max(queue.topPriority().PXZ, queue.topPriority().PYZ) > 0.5)
   {
-    OT::UnsignedInteger X, Y, Z;
-    X = std::get< 0 >(*std::get< 0 >(best));
-    Y = std::get< 1 >(*std::get< 0 >(best));
-    Z = std::get< 2 >(*std::get< 0 >(best));
+    // the triples not examined yet leave their edges unoriented
+    if (control_.report("orientation", 0, queue.size(), testsNumber_))
+      break;
+    const TripleRecord best = queue.topPriority();
+    const OT::UnsignedInteger X = best.X;
+    const OT::UnsignedInteger Y = best.Y;
+    const OT::UnsignedInteger Z = best.Z;
     TRACE("\tTriple: (" << X << "," << Y << "," << Z << ")" << std::endl);
 
-    const double I3 = std::get< 1 >(best);
+    const double I3 = best.I;
 
     if (I3 <= 0)
     {
       // v-structure discovery
       if (marks[ {X, Z}] == 'o' && marks[ {Y, Z}] == 'o')  // If x-z-y
       {
-        if (!existsDirectedPath(pdag_, Z, X, false))
+        if (!existsDirectedPath(Z, X, false))
         {
           pdag_.eraseEdge(gum::Edge(X, Z));
-          pdag_.addArc(X, Z);
+          addPDAGArc(X, Z);
           TRACE("\t\t1.a Removing edge (" << X << "," << Z << ")" << std::endl);
           TRACE("\t\t1.a Adding arc (" << X << "," << Z << ")" << std::endl);
           marks[ {X, Z}] = '>';
@@ -449,25 +804,25 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
             latent_couples_.push_back(gum::Arc(Z, X));
           }
           if (!arc_probas_.exists(gum::Arc(X, Z)))
-            arc_probas_.insert(gum::Arc(X, Z), std::get< 2 >(best));
+            arc_probas_.insert(gum::Arc(X, Z), best.PXZ);
         }
         else
         {
           pdag_.eraseEdge(gum::Edge(X, Z));
           TRACE("\t\t1.b Adding arc (" << X << "," << Z << ")" << std::endl);
-          if (!existsDirectedPath(pdag_, X, Z, false))
+          if (!existsDirectedPath(X, Z, false))
           {
-            pdag_.addArc(Z, X);
+            addPDAGArc(Z, X);
             TRACE("\t\t1.b Removing edge (" << X << "," << Z << ")"
                   << std::endl);
             marks[ {Z, X}] = '>';
           }
         }
 
-        if (!existsDirectedPath(pdag_, Z, Y, false))
+        if (!existsDirectedPath(Z, Y, false))
         {
           pdag_.eraseEdge(gum::Edge(Y, Z));
-          pdag_.addArc(Y, Z);
+          addPDAGArc(Y, Z);
           TRACE("\t\t1.c Removing edge (" << Y << "," << Z << ")"
                 << std::endl);
           TRACE("\t\t1.c Adding arc (" << Y << "," << Z << ")"
@@ -487,16 +842,16 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
           }
           auto arc = gum::Arc(Y, Z);
           if (!arc_probas_.exists(arc))
-            arc_probas_.insert(arc, std::get< 3 >(best));
+            arc_probas_.insert(arc, best.PYZ);
         }
         else
         {
           pdag_.eraseEdge(gum::Edge(Y, Z));
           TRACE("\t\t1.d Removing edge (" << Y << "," << Z << ")"
                 << std::endl);
-          if (!existsDirectedPath(pdag_, Y, Z, false))
+          if (!existsDirectedPath(Y, Z, false))
           {
-            pdag_.addArc(Z, Y);
+            addPDAGArc(Z, Y);
             TRACE("\t\t1.d Adding arc (" << Z << "," << Y << ")"
                   << std::endl);
             marks[ {Z, Y}] = '>';
@@ -505,10 +860,10 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
       }
       else if (marks[ {X, Z}] == '>' && marks[ {Y, Z}] == 'o') // If x->z-y
       {
-        if (!existsDirectedPath(pdag_, Z, Y, false))
+        if (!existsDirectedPath(Z, Y, false))
         {
           pdag_.eraseEdge(gum::Edge(Y, Z));
-          pdag_.addArc(Y, Z);
+          addPDAGArc(Y, Z);
           TRACE("\t\t2.a Removing edge (" << Y << "," << Z << ")" << std::endl);
           TRACE("\t\t2.a Adding arc (" << Y << "," << Z << ")" << std::endl);
           marks[ {Y, Z}] = '>';
@@ -526,16 +881,16 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
           }
           auto arc = gum::Arc(Y, Z);
           if (!arc_probas_.exists(arc))
-            arc_probas_.insert(arc, std::get< 3 >(best));
+            arc_probas_.insert(arc, best.PYZ);
         }
         else
         {
           pdag_.eraseEdge(gum::Edge(Y, Z));
           TRACE("\t\t2.b Removing edge (" << Y << "," << Z << ")"
                 << std::endl);
-          if (!existsDirectedPath(pdag_, Y, Z, false))
+          if (!existsDirectedPath(Y, Z, false))
           {
-            pdag_.addArc(Z, Y);
+            addPDAGArc(Z, Y);
             TRACE("\t\t2.b Adding arc (" << Y << "," << Z << ")"
                   << std::endl);
             marks[ {Z, Y}] = '>';
@@ -544,10 +899,10 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
       }
       else if (marks[ {Y, Z}] == '>' && marks[ {X, Z}] == 'o')
       {
-        if (!existsDirectedPath(pdag_, Z, X, false))
+        if (!existsDirectedPath(Z, X, false))
         {
           pdag_.eraseEdge(gum::Edge(X, Z));
-          pdag_.addArc(X, Z);
+          addPDAGArc(X, Z);
           TRACE("\t\t3.a Removing edge (" << X << "," << Z << ")"
                 << std::endl);
           TRACE("\t\t3.a Adding arc (" << X << "," << Z << ")"
@@ -567,16 +922,16 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
           }
           auto arc = gum::Arc(X, Z);
           if (!arc_probas_.exists(arc))
-            arc_probas_.insert(arc, std::get< 2 >(best));
+            arc_probas_.insert(arc, best.PXZ);
         }
         else
         {
           pdag_.eraseEdge(gum::Edge(X, Z));
           TRACE("\t\t3.b Removing edge (" << X << "," << Z << ")"
                 << std::endl);
-          if (!existsDirectedPath(pdag_, X, Z, false))
+          if (!existsDirectedPath(X, Z, false))
           {
-            pdag_.addArc(Z, X);
+            addPDAGArc(Z, X);
             TRACE("\t\t3.b Adding arc (" << X << "," << Z << ")"
                   << std::endl);
             marks[ {Z, X}] = '>';
@@ -594,48 +949,48 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
         pdag_.eraseEdge(gum::Edge(Z, Y));
         TRACE("\t\t4. Removing edge (" << Z << "," << Y << ")"
               << std::endl);
-        if (!existsDirectedPath(pdag_, Y, Z) && pdag_.parents(Y).empty())
+        if (!existsDirectedPath(Y, Z) && pdag_.parents(Y).empty())
         {
-          pdag_.addArc(Z, Y);
+          addPDAGArc(Z, Y);
           TRACE("\t\t4.a Adding arc (" << Z << "," << Y << ")"
                 << std::endl);
           marks[ {Z, Y}] = '>';
           marks[ {Y, Z}] = '-';
           if (!arc_probas_.exists(gum::Arc(Z, Y)))
-            arc_probas_.insert(gum::Arc(Z, Y), std::get< 3 >(best));
+            arc_probas_.insert(gum::Arc(Z, Y), best.PYZ);
         }
-        else if (!existsDirectedPath(pdag_, Z, Y)
+        else if (!existsDirectedPath(Z, Y)
                  && pdag_.parents(Z).empty())
         {
-          pdag_.addArc(Y, Z);
+          addPDAGArc(Y, Z);
           TRACE("\t\t4.b Adding arc (" << Y << "," << Z << ")"
                 << std::endl);
           marks[ {Z, Y}] = '-';
           marks[ {Y, Z}] = '>';
           latent_couples_.push_back(gum::Arc(Y, Z));
           if (!arc_probas_.exists(gum::Arc(Y, Z)))
-            arc_probas_.insert(gum::Arc(Y, Z), std::get< 3 >(best));
+            arc_probas_.insert(gum::Arc(Y, Z), best.PYZ);
         }
-        else if (!existsDirectedPath(pdag_, Y, Z))
+        else if (!existsDirectedPath(Y, Z))
         {
-          pdag_.addArc(Z, Y);
+          addPDAGArc(Z, Y);
           TRACE("\t\t4.c Adding arc (" << Z << "," << Y << ")"
                 << std::endl);
           marks[ {Z, Y}] = '>';
           marks[ {Y, Z}] = '-';
           if (!arc_probas_.exists(gum::Arc(Z, Y)))
-            arc_probas_.insert(gum::Arc(Z, Y), std::get< 3 >(best));
+            arc_probas_.insert(gum::Arc(Z, Y), best.PYZ);
         }
-        else if (!existsDirectedPath(pdag_, Z, Y))
+        else if (!existsDirectedPath(Z, Y))
         {
-          pdag_.addArc(Y, Z);
+          addPDAGArc(Y, Z);
           TRACE("\t\t4.d Adding arc (" << Y << "," << Z << ")"
                 << std::endl);
           latent_couples_.push_back(gum::Arc(Y, Z));
           marks[ {Z, Y}] = '-';
           marks[ {Y, Z}] = '>';
           if (!arc_probas_.exists(gum::Arc(Y, Z)))
-            arc_probas_.insert(gum::Arc(Y, Z), std::get< 3 >(best));
+            arc_probas_.insert(gum::Arc(Y, Z), best.PYZ);
         }
 
       }
@@ -645,85 +1000,87 @@ gum::MixedGraph ContinuousMIIC::learnPDAG()
         pdag_.eraseEdge(gum::Edge(Z, X));
         TRACE("\t\t5. Removing edge (" << Z << "," << X << ")"
               << std::endl);
-        if (!existsDirectedPath(pdag_, X, Z) && pdag_.parents(X).empty())
+        if (!existsDirectedPath(X, Z) && pdag_.parents(X).empty())
         {
-          pdag_.addArc(Z, X);
+          addPDAGArc(Z, X);
           TRACE("\t\t5.a Adding arc (" << Z << "," << X << ")"
                 << std::endl);
           marks[ {Z, X}] = '>';
           marks[ {X, Z}] = '-';
           if (!arc_probas_.exists(gum::Arc(Z, X)))
-            arc_probas_.insert(gum::Arc(Z, X), std::get< 2 >(best));
+            arc_probas_.insert(gum::Arc(Z, X), best.PXZ);
         }
-        else if (!existsDirectedPath(pdag_, Z, X)
+        else if (!existsDirectedPath(Z, X)
                  && pdag_.parents(Z).empty())
         {
-          pdag_.addArc(X, Z);
+          addPDAGArc(X, Z);
           TRACE("\t\t5.b Adding arc (" << X << "," << Z << ")"
                 << std::endl);
           marks[ {Z, X}] = '-';
           marks[ {X, Z}] = '>';
           latent_couples_.push_back(gum::Arc(X, Z));
           if (!arc_probas_.exists(gum::Arc(X, Z)))
-            arc_probas_.insert(gum::Arc(X, Z), std::get< 2 >(best));
+            arc_probas_.insert(gum::Arc(X, Z), best.PXZ);
         }
-        else if (!existsDirectedPath(pdag_, X, Z))
+        else if (!existsDirectedPath(X, Z))
         {
-          pdag_.addArc(Z, X);
+          addPDAGArc(Z, X);
           TRACE("\t\t5.c Adding arc (" << Z << "," << X << ")"
                 << std::endl);
           marks[ {Z, X}] = '>';
           marks[ {X, Z}] = '-';
           if (!arc_probas_.exists(gum::Arc(Z, X)))
-            arc_probas_.insert(gum::Arc(Z, X), std::get< 2 >(best));
+            arc_probas_.insert(gum::Arc(Z, X), best.PXZ);
         }
-        else if (!existsDirectedPath(pdag_, Z, X))
+        else if (!existsDirectedPath(Z, X))
         {
-          pdag_.addArc(X, Z);
+          addPDAGArc(X, Z);
           TRACE("\t\t5.d Adding arc (" << X << "," << Z << ")"
                 << std::endl);
           marks[ {Z, X}] = '-';
           marks[ {X, Z}] = '>';
           latent_couples_.push_back(gum::Arc(X, Z));
           if (!arc_probas_.exists(gum::Arc(X, Z)))
-            arc_probas_.insert(gum::Arc(X, Z), std::get< 2 >(best));
+            arc_probas_.insert(gum::Arc(X, Z), best.PXZ);
         }
       }
     }
 
-    delete std::get< 0 >(best);
-    proba_triples.erase(proba_triples.begin());
-
-    // actualisation of the list of triples
-    proba_triples = updateProbaTriples(pdag_, proba_triples);
+    queue.eraseTop();
 
-
-    if (!proba_triples.empty())
+    // actualisation of the triples whose arcs have changed, the other ones
+    // being left unchanged by updateProbaTriple
+    for (const auto &arc : changedArcs_)
     {
-      best = proba_triples[0];
+      const gum::Edge edge(arc.tail(), arc.head());
+      if (!edgeTriples.exists(edge))
+        continue;
+      for (const auto index : edgeTriples[edge])
+        if (queue.contains(index))
+        {
+          updateProbaTriple(pdag_, triples[index]);
+          queue.setPriority(index, triples[index]);
+        }
     }
-
-
+    changedArcs_.clear();
   }   // while
 
   // erasing the double headed arcs
   for (auto iter = latent_couples_.rbegin(); iter != latent_couples_.rend();
        ++iter)
   {
-    pdag_.eraseArc(gum::Arc(iter->head(), iter->tail()));
-    if (existsDirectedPath(pdag_, iter->head(), iter->tail()))
+    erasePDAGArc(iter->head(), iter->tail());
+    if (existsDirectedPath(iter->head(), iter->tail()))
     {
       // if we find a cycle, we force the competing edge
-      pdag_.addArc(iter->head(), iter->tail());
-      pdag_.eraseArc(gum::Arc(iter->tail(), iter->head()));
+      addPDAGArc(iter->head(), iter->tail());
+      erasePDAGArc(iter->tail(), iter->head());
       *iter = gum::Arc(iter->head(), iter->tail());
     }
   }
 
+  changedArcs_.clear();
   pdag_done_ = true;
-  // clean up remaining heap-allocated tuples
-  for (auto &entry : proba_triples)
-    delete std::get<0>(entry);
   TRACE("===== ENDING PDAG LEARNING =====" << std::endl);
   return pdag_;
 }
@@ -778,21 +1135,59 @@ std::vector< std::string > ContinuousMIIC::namesFromData() const
 }
 
 
-std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger >*,
-    double, double, double > >
-    ContinuousMIIC::getUnshieldedTriples(
-      const gum::MixedGraph& graph,
-      gum::HashTable< std::pair< gum::NodeId, gum::NodeId >, char >& marks)
+// the triples of a pair X, Y sharing the same conditioning set U, whose
+// informations are computed by one batch
+struct ContinuousMIIC::TripleGroup
+{
+  OT::UnsignedInteger X = 0;
+  OT::UnsignedInteger Y = 0;
+  OT::Indices U;
+  OT::Indices Zs;
+  // positions of the triples in the list of getUnshieldedTriples
+  std::vector<OT::UnsignedInteger> positions;
+};
+
+struct ContinuousMIIC::TriplePolicy
+{
+  const std::vector<TripleGroup> &groups_;
+  const OT::UnsignedInteger start_;
+  std::vector<CorrectedMutualInformation> &infos_;
+  std::vector<TripleRecord> &triples_;
+
+  TriplePolicy(const std::vector<TripleGroup> &groups,
+               const OT::UnsignedInteger start,
+               std::vector<CorrectedMutualInformation> &infos,
+               std::vector<TripleRecord> &triples)
+    : groups_(groups), start_(start), infos_(infos), triples_(triples)
+  {
+  }
+
+  // each group writes the informations of its own triples
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger i = r.begin(); i != r.end(); ++i)
+    {
+      const TripleGroup &group = groups_[start_ + i];
+      const OT::Point I(infos_[i].compute3PtCorrectedInformations(group.X, group.Y, group.Zs, group.U));
+      for (OT::UnsignedInteger k = 0; k < group.positions.size(); ++k)
+        triples_[group.positions[k]].I = I[k];
+    }
+  }
+};
+
+// the triples are listed first, their informations are computed in parallel
+// by batches of groups with local entropy caches, then the probabilities and
+// the marks are assembled in the order of the list, as in a serial loop
+std::vector< TripleRecord > ContinuousMIIC::getUnshieldedTriples(
+  const gum::MixedGraph& graph,
+  gum::HashTable< std::pair< gum::NodeId, gum::NodeId >, char >& marks)
 {
   TRACE("\tLooking for unshielded triples" << std::endl);
-  std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger >*,
-      double,
-      double,
-      double > > triples;
+  std::vector< TripleRecord > triples;
+  std::vector< TripleGroup > groups;
+  // group of the triples of a pair whose separator does not contain Z
+  std::map< std::pair< gum::NodeId, gum::NodeId >, OT::UnsignedInteger > pairGroups;
 
   for (gum::NodeId Z : graph)
   {
@@ -804,288 +1199,425 @@ std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
         {
           OT::Indices U;
           auto key = gum::Edge(X, Y);
-          //std::pair< gum::NodeId, gum::NodeId > rev_key = {Y, X};
           if (sepset_.exists(key))
           {
             U = sepset_[key];
           }
-          //else if (sepset_.exists(rev_key)) {
-          //U = sepset_[rev_key];
-          //}
           // remove z from ui if it's present
           const auto iter_Z_place = std::find(U.begin(), U.end(), Z);
-          if (iter_Z_place != U.end())
+          const bool inSepset = (iter_Z_place != U.end());
+          if (inSepset)
           {
             U.erase(iter_Z_place);
           }
 
-          const double IXYZ_U =
-            info_.compute3PtCorrectedInformation(X, Y, Z, U);
-          auto tup = new std::tuple< OT::UnsignedInteger,
-          OT::UnsignedInteger,
-          OT::UnsignedInteger > {X, Y, Z};
-          std::tuple< std::tuple< OT::UnsignedInteger,
-              OT::UnsignedInteger,
-              OT::UnsignedInteger >*,
-              double,
-              double,
-              double > triple{tup, IXYZ_U, 0.5, 0.5};
+          TripleRecord triple;
+          triple.X = X;
+          triple.Y = Y;
+          triple.Z = Z;
+          triple.index = triples.size();
           triples.push_back(triple);
-          if (!marks.exists({X, Z}))
-          {
-            marks.insert({X, Z}, 'o');
-          }
-          if (!marks.exists({Z, X}))
-          {
-            marks.insert({Z, X}, 'o');
-          }
-          if (!marks.exists({Y, Z}))
-          {
-            marks.insert({Y, Z}, 'o');
-          }
-          if (!marks.exists({Z, Y}))
+
+          const auto pair = std::make_pair(X, Y);
+          const auto found = pairGroups.find(pair);
+          OT::UnsignedInteger position = groups.size();
+          if (!inSepset && (found != pairGroups.end()))
+            position = found->second;
+          else
           {
-            marks.insert({Z, Y}, 'o');
+            TripleGroup group;
+            group.X = X;
+            group.Y = Y;
+            group.U = U;
+            groups.push_back(group);
+            if (!inSepset)
+              pairGroups[pair] = position;
           }
+          groups[position].Zs.add(Z);
+          groups[position].positions.push_back(triple.index);
         }
       }
     }
   }
-  triples = updateProbaTriples(graph, triples);
-  std::sort(triples.begin(), triples.end(), GreaterTupleOnLast());
-  for (const auto & triple : triples)
-  {
-    OT::UnsignedInteger X, Y, Z;
-    X = std::get< 0 >(*std::get< 0 >(triple));
-    Y = std::get< 1 >(*std::get< 0 >(triple));
-    Z = std::get< 2 >(*std::get< 0 >(triple));
 
-    const double IXYZ = std::get< 1 >(triple);
-    double       PXZ = std::get< 2 >(triple);
-    double       PYZ = std::get< 3 >(triple);
+  const OT::UnsignedInteger batchSize = std::max<OT::UnsignedInteger>(1,
+                                        OT::ResourceMap::GetAsUnsignedInteger("ContinuousMIIC-TriplesBatchSize"));
+  for (OT::UnsignedInteger start = 0; start < groups.size(); start += batchSize)
+  {
+    const OT::UnsignedInteger size = std::min<OT::UnsignedInteger>(batchSize, groups.size() - start);
+    std::vector<CorrectedMutualInformation> infos(size, info_.getLocalCopy());
+    const TriplePolicy policy(groups, start, infos, triples);
+    OT::TBBImplementation::ParallelFor(0, size, policy);
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
+      info_.mergeCaches(infos[i]);
+  }
 
+  for (auto &triple : triples)
+  {
+    const gum::NodeId X = triple.X;
+    const gum::NodeId Y = triple.Y;
+    const gum::NodeId Z = triple.Z;
+    updateProbaTriple(graph, triple);
     TRACE("\t\t(" << X << ", " << Y << ", " << Z << ", "
-          << IXYZ << ", " << PXZ << ", " << PYZ << ")" << std::endl);
+          << triple.I << ", " << triple.PXZ << ", " << triple.PYZ << ")" << std::endl);
+    if (!marks.exists({X, Z}))
+    {
+      marks.insert({X, Z}, 'o');
+    }
+    if (!marks.exists({Z, X}))
+    {
+      marks.insert({Z, X}, 'o');
+    }
+    if (!marks.exists({Y, Z}))
+    {
+      marks.insert({Y, Z}, 'o');
+    }
+    if (!marks.exists({Z, Y}))
+    {
+      marks.insert({Z, Y}, 'o');
+    }
   }
   return triples;
 }
 
-std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-OT::UnsignedInteger,
-OT::UnsignedInteger >*,
-double, double, double > >
-ContinuousMIIC::updateProbaTriples(
-  const gum::MixedGraph& graph,
-  std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::UnsignedInteger >*,
-  double, double, double > > proba_triples)
+// the probabilities of the heads of the triple given the arcs of graph; a
+// second call with the same arcs does not change them
+void ContinuousMIIC::updateProbaTriple(const gum::MixedGraph& graph,
+                                       TripleRecord& triple) const
 {
-  for (auto& triple : proba_triples)
+  const OT::UnsignedInteger X = triple.X;
+  const OT::UnsignedInteger Y = triple.Y;
+  const OT::UnsignedInteger Z = triple.Z;
+  const double IXYZ = triple.I;
+  const double PXZ = triple.PXZ;
+  const double PYZ = triple.PYZ;
+
+  if (IXYZ <= 0)
   {
-    OT::UnsignedInteger X, Y, Z;
-    X = std::get< 0 >(*std::get< 0 >(triple));
-    Y = std::get< 1 >(*std::get< 0 >(triple));
-    Z = std::get< 2 >(*std::get< 0 >(triple));
-    const double IXYZ = std::get< 1 >(triple);
-    double       PXZ = std::get< 2 >(triple);
-    double       PYZ = std::get< 3 >(triple);
-
-    if (IXYZ <= 0)
+    const double expo = std::exp(static_cast<double>(info_.getSize()) * IXYZ);
+    const double P0 = (1 + expo) / (1 + 3 * expo);
+    // distinguish between the initialization and the update process
+    if (PXZ == PYZ && PYZ == 0.5)
     {
-      const double expo = std::exp(static_cast<double>(info_.getSize()) * IXYZ);
-      const double P0 = (1 + expo) / (1 + 3 * expo);
-      // distinguish between the initialization and the update process
-      if (PXZ == PYZ && PYZ == 0.5)
-      {
-        std::get< 2 >(triple) = P0;
-        std::get< 3 >(triple) = P0;
-      }
-      else
-      {
-        if (graph.existsArc(X, Z) && PXZ >= P0)
-        {
-          std::get< 3 >(triple) = PXZ * (1 / (1 + expo) - 0.5) + 0.5;
-        }
-        else if (graph.existsArc(Y, Z) && PYZ >= P0)
-        {
-          std::get< 2 >(triple) = PYZ * (1 / (1 + expo) - 0.5) + 0.5;
-        }
-      }
+      triple.PXZ = P0;
+      triple.PYZ = P0;
     }
     else
     {
-      const double expo = std::exp(- static_cast<double>(info_.getSize()) * IXYZ);
-      if (graph.existsArc(X, Z) && PXZ >= 0.5)
+      if (graph.existsArc(X, Z) && PXZ >= P0)
       {
-        std::get< 3 >(triple) = PXZ * (1 / (1 + expo) - 0.5) + 0.5;
+        triple.PYZ = PXZ * (1 / (1 + expo) - 0.5) + 0.5;
       }
-      else if (graph.existsArc(Y, Z) && PYZ >= 0.5)
+      else if (graph.existsArc(Y, Z) && PYZ >= P0)
       {
-        std::get< 2 >(triple) = PYZ * (1 / (1 + expo) - 0.5) + 0.5;
+        triple.PXZ = PYZ * (1 / (1 + expo) - 0.5) + 0.5;
       }
     }
   }
-  std::sort(proba_triples.begin(), proba_triples.end(), GreaterTupleOnLast());
-  return proba_triples;
+  else
+  {
+    const double expo = std::exp(- static_cast<double>(info_.getSize()) * IXYZ);
+    if (graph.existsArc(X, Z) && PXZ >= 0.5)
+    {
+      triple.PYZ = PXZ * (1 / (1 + expo) - 0.5) + 0.5;
+    }
+    else if (graph.existsArc(Y, Z) && PYZ >= 0.5)
+    {
+      triple.PXZ = PYZ * (1 / (1 + expo) - 0.5) + 0.5;
+    }
+  }
+}
+
+void ContinuousMIIC::addPDAGArc(const gum::NodeId tail, const gum::NodeId head)
+{
+  pdag_.addArc(tail, head);
+  reachability_.addArc(tail, head);
+  changedArcs_.push_back(gum::Arc(tail, head));
 }
 
-bool ContinuousMIIC::existsDirectedPath(const gum::MixedGraph& graph,
-                                        const OT::UnsignedInteger n1,
+void ContinuousMIIC::erasePDAGArc(const gum::NodeId tail, const gum::NodeId head)
+{
+  pdag_.eraseArc(gum::Arc(tail, head));
+  reachability_.eraseArc(tail, head);
+  changedArcs_.push_back(gum::Arc(tail, head));
+}
+
+// the double arcs are not part of the paths; the orientation keeps the other
+// arcs acyclic so that a path avoiding the arc n1->n2 ends with another parent
+bool ContinuousMIIC::existsDirectedPath(const OT::UnsignedInteger n1,
                                         const OT::UnsignedInteger n2,
                                         const bool countArc) const
 {
-  // not recursive version => use a FIFO for simulating the recursion
-  gum::List< gum::NodeId > nodeFIFO;
-  nodeFIFO.pushBack(n2);
-
-  // mark[node] = successor if visited, else mark[node] does not exist
-  gum::NodeProperty< gum::NodeId > mark;
-  mark.insert(n2, n2);
+  if (countArc)
+    return reachability_.existsPath(n1, n2);
+  return reachability_.existsPathAvoidingArc(n1, n2);
+}
 
-  gum::NodeId current;
 
-  while (!nodeFIFO.empty())
+struct ContinuousMIIC::ContributorPolicy
+{
+  const ContinuousMIIC &miic_;
+  const OT::UnsignedInteger X_;
+  const OT::UnsignedInteger Y_;
+  const OT::Indices &U_;
+  const double IXY_U_;
+  const std::vector<OT::UnsignedInteger> &candidates_;
+  const OT::UnsignedInteger batchSize_;
+  std::vector<CorrectedMutualInformation> &infos_;
+  std::vector<double> &probabilities_;
+
+  ContributorPolicy(const ContinuousMIIC &miic,
+                    const OT::UnsignedInteger X,
+                    const OT::UnsignedInteger Y,
+                    const OT::Indices &U,
+                    const double IXY_U,
+                    const std::vector<OT::UnsignedInteger> &candidates,
+                    const OT::UnsignedInteger batchSize,
+                    std::vector<CorrectedMutualInformation> &infos,
+                    std::vector<double> &probabilities)
+    : miic_(miic), X_(X), Y_(Y), U_(U), IXY_U_(IXY_U)
+    , candidates_(candidates), batchSize_(batchSize)
+    , infos_(infos), probabilities_(probabilities)
   {
-    current = nodeFIFO.front();
-    nodeFIFO.popFront();
-
-    // check the parents
+  }
 
-    for (const auto & new_one : graph.parents(current))
+  // the 3-point informations of each batch of candidates are computed in
+  // one call by the local copy of the batch
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger batch = r.begin(); batch != r.end(); ++batch)
     {
-      if (!countArc && current == n2 && new_one == n1)  // If countArc is set to false
-        continue;                                       // paths of length 1 are ignored
-
-      if (mark.exists(new_one))   // if this node is already marked, do not
-        continue;                 // check it again
-
-      if (graph.existsArc(current,
-                          new_one))   // if there is a double arc, pass
-        continue;
-
-      mark.insert(new_one, current);
-
-      if (new_one == n1)
-      {
-        return true;
-      }
-
-      nodeFIFO.pushBack(new_one);
+      CorrectedMutualInformation &info = infos_[batch];
+      const OT::UnsignedInteger first = batch * batchSize_;
+      const OT::UnsignedInteger last = std::min<OT::UnsignedInteger>(first + batchSize_, candidates_.size());
+      OT::Indices Zs;
+      for (OT::UnsignedInteger i = first; i < last; ++i)
+        Zs.add(candidates_[i]);
+      const OT::Point IXYZ_U(info.compute3PtCorrectedInformations(X_, Y_, Zs, U_));
+      for (OT::UnsignedInteger i = first; i < last; ++i)
+        probabilities_[i] = miic_.computeContributorProbability(info, X_, Y_, candidates_[i], U_,
+                            IXY_U_, IXYZ_U[i - first]);
     }
   }
+};
 
-  return false;
-}
-
-
+// the batches of candidates are evaluated in parallel with local entropy
+// caches, then the first best one in the order of the nodes is kept as in a
+// serial loop
 void ContinuousMIIC::findBestContributor(const OT::UnsignedInteger X,
     const OT::UnsignedInteger Y,
     const OT::Indices &U)
 {
   TRACE("\n\tLooking for best contributor" << std::endl);
+  const std::vector<OT::UnsignedInteger> candidates(getContributorCandidates(X, Y, U));
+  const double IXY_U = info_.compute2PtCorrectedInformation(X, Y, U);
+  const OT::UnsignedInteger batchSize = std::max<OT::UnsignedInteger>(1,
+                                        OT::ResourceMap::GetAsUnsignedInteger("ContinuousMIIC-ContributorsBatchSize"));
+  const OT::UnsignedInteger batchesNumber = (candidates.size() + batchSize - 1) / batchSize;
+  std::vector<CorrectedMutualInformation> infos(batchesNumber, info_.getLocalCopy());
+  std::vector<double> probabilities(candidates.size());
+  const ContributorPolicy policy(*this, X, Y, U, IXY_U, candidates, batchSize, infos, probabilities);
+  OT::TBBImplementation::ParallelFor(0, batchesNumber, policy);
+  for (OT::UnsignedInteger batch = 0; batch < batchesNumber; ++batch)
+    info_.mergeCaches(infos[batch]);
+
   double maxP = -1.;
   OT::UnsignedInteger maxZ = 0;
+  for (OT::UnsignedInteger i = 0; i < candidates.size(); ++i)
+  {
+    if (probabilities[i] > maxP)
+    {
+      maxP = probabilities[i];
+      maxZ = candidates[i];
+    }
+  }
+  testsNumber_ += candidates.size();
+  TRACE("\tBest contributor: (" << maxZ << ", " << maxP << ")" << std::endl);
+  insertContributor(X, Y, maxZ, U, maxP);
+}
 
-  const double IXY_U = info_.compute2PtCorrectedInformation(X, Y, U);
-
+// the nodes other than X, Y and U, restricted to the neighbours of X or Y and
+// to the contributorsNumber_ best ones according to the pairwise information
+std::vector<OT::UnsignedInteger>
+ContinuousMIIC::getContributorCandidates(const OT::UnsignedInteger X,
+    const OT::UnsignedInteger Y,
+    const OT::Indices &U)
+{
+  std::vector<OT::UnsignedInteger> candidates;
   for (const auto & Z : skeleton_.nodes())
   {
-    if (Z != X && Z != Y && std::find(U.begin(), U.end(), Z) == U.end())
-    {
-      TRACE("\t\tCondidering node " << Z << std::endl);
-      double Pnv = 0.;
-      double Pb = 0.;
+    if (Z == X || Z == Y || std::find(U.begin(), U.end(), Z) != U.end())
+      continue;
+    if (neighbourContributors_ && !skeleton_.existsEdge(X, Z) && !skeleton_.existsEdge(Y, Z))
+      continue;
+    candidates.push_back(Z);
+  }
+  if ((contributorsNumber_ == 0) || (candidates.size() <= contributorsNumber_))
+    return candidates;
 
-      const double IXYZ_U = info_.compute3PtCorrectedInformation(X, Y, Z, U);
-      TRACE("\t\t\tI(" << X << ", " << Y << ", " << Z << " | "
-            << U << ") = " << IXYZ_U << std::endl);
-      double f1 = - static_cast<double>(info_.getSize()) * IXYZ_U;
+  // the pairwise information is in the cache since the initiation
+  std::vector<std::pair<double, OT::UnsignedInteger> > scores;
+  for (OT::UnsignedInteger i = 0; i < candidates.size(); ++i)
+  {
+    const double score = info_.compute2PtCorrectedInformation(X, candidates[i])
+                         + info_.compute2PtCorrectedInformation(Y, candidates[i]);
+    scores.push_back(std::make_pair(-score, i));
+  }
+  std::sort(scores.begin(), scores.end());
+  std::vector<OT::UnsignedInteger> kept;
+  for (OT::UnsignedInteger i = 0; i < contributorsNumber_; ++i)
+    kept.push_back(scores[i].second);
+  std::sort(kept.begin(), kept.end());
+  std::vector<OT::UnsignedInteger> best;
+  for (const auto i : kept)
+    best.push_back(candidates[i]);
+  return best;
+}
 
-      if (f1 > maxLog_)
-      {
-        Pnv = 0.;
-      }
-      else if (f1 < -maxLog_)
-      {
-        Pnv = 1.;
-      }
-      else
-      {
-        Pnv = 1 / (1 + std::exp(f1));
-      }
-      TRACE("\t\t\tPnv = " << Pnv << std::endl);
+// min(Pnv, Pb) of the contributor Z of X-Y given U
+double ContinuousMIIC::computeContributorProbability(CorrectedMutualInformation &info,
+    const OT::UnsignedInteger X,
+    const OT::UnsignedInteger Y,
+    const OT::UnsignedInteger Z,
+    const OT::Indices &U,
+    const double IXY_U,
+    const double IXYZ_U) const
+{
+  TRACE("\t\tCondidering node " << Z << std::endl);
+  double Pnv = 0.;
+  double Pb = 0.;
+  TRACE("\t\t\tI(" << X << ", " << Y << ", " << Z << " | "
+        << U << ") = " << IXYZ_U << std::endl);
+  double f1 = - static_cast<double>(info.getSize()) * IXYZ_U;
+
+  if (f1 > maxLog_)
+  {
+    Pnv = 0.;
+  }
+  else if (f1 < -maxLog_)
+  {
+    Pnv = 1.;
+  }
+  else
+  {
+    Pnv = 1 / (1 + std::exp(f1));
+  }
+  TRACE("\t\t\tPnv = " << Pnv << std::endl);
 
-      const double IXZ_U = info_.compute2PtCorrectedInformation(X, Z, U);
-      const double IYZ_U = info_.compute2PtCorrectedInformation(Y, Z, U);
-      TRACE("\t\t\tI(" << X << ", " << Y << " | "
-            << U << ") = " << IXY_U << std::endl);
-      TRACE("\t\t\tI(" << X << ", " << Z << " | "
-            << U << ") = " << IXZ_U << std::endl);
-      TRACE("\t\t\tI(" << Y << ", " << Z << " | "
-            << U << ") = " << IYZ_U << std::endl);
+  const double IXZ_U = info.compute2PtCorrectedInformation(X, Z, U);
+  const double IYZ_U = info.compute2PtCorrectedInformation(Y, Z, U);
+  TRACE("\t\t\tI(" << X << ", " << Y << " | "
+        << U << ") = " << IXY_U << std::endl);
+  TRACE("\t\t\tI(" << X << ", " << Z << " | "
+        << U << ") = " << IXZ_U << std::endl);
+  TRACE("\t\t\tI(" << Y << ", " << Z << " | "
+        << U << ") = " << IYZ_U << std::endl);
 
-      f1 = - static_cast<double>(info_.getSize()) * (IXZ_U - IXY_U);
-      double f2 = - static_cast<double>(info_.getSize()) * (IYZ_U - IXY_U);
+  f1 = - static_cast<double>(info.getSize()) * (IXZ_U - IXY_U);
+  double f2 = - static_cast<double>(info.getSize()) * (IYZ_U - IXY_U);
 
 
-      if (f1 > maxLog_ || f2 > maxLog_)
-      {
-        Pb = 0.;
-      }
-      else if (f1 < -maxLog_ && f2 < -maxLog_)
-      {
-        Pb = 1.;
-      }
-      else
-      {
-        double expo1 = 0.;
-        double expo2 = 0.;
-        if (f1 < -maxLog_)
-        {
-          expo1 = 0.;
-        }
-        else
-        {
-          expo1 = std::exp(f1);
-        }
-        if (f2 < -maxLog_)
-        {
-          expo2 = 0.;
-        }
-        else
-        {
-          expo2 = std::exp(f2);
-        }
-        Pb = 1 / (1 + expo1 + expo2);
-      }
-      TRACE("\t\t\tPb = " << Pb << std::endl);
+  if (f1 > maxLog_ || f2 > maxLog_)
+  {
+    Pb = 0.;
+  }
+  else if (f1 < -maxLog_ && f2 < -maxLog_)
+  {
+    Pb = 1.;
+  }
+  else
+  {
+    double expo1 = 0.;
+    double expo2 = 0.;
+    if (f1 < -maxLog_)
+    {
+      expo1 = 0.;
+    }
+    else
+    {
+      expo1 = std::exp(f1);
+    }
+    if (f2 < -maxLog_)
+    {
+      expo2 = 0.;
+    }
+    else
+    {
+      expo2 = std::exp(f2);
+    }
+    Pb = 1 / (1 + expo1 + expo2);
+  }
+  TRACE("\t\t\tPb = " << Pb << std::endl);
+  return std::min(Pnv, Pb);
+}
 
-      const double min_pnv_pb = std::min(Pnv, Pb);
-      if (min_pnv_pb > maxP)
-      {
-        maxP = min_pnv_pb;
-        maxZ = Z;
-      }
+// the contributor, its probability (-1 if none) and the number of nodes tried
+std::tuple<OT::UnsignedInteger, double, OT::UnsignedInteger>
+ContinuousMIIC::computeBestContributor(CorrectedMutualInformation &info,
+                                       const OT::UnsignedInteger X,
+                                       const OT::UnsignedInteger Y,
+                                       const OT::Indices &U) const
+{
+  TRACE("\n\tLooking for best contributor" << std::endl);
+  double maxP = -1.;
+  OT::UnsignedInteger maxZ = 0;
+  OT::UnsignedInteger testsNumber = 0;
+
+  const double IXY_U = info.compute2PtCorrectedInformation(X, Y, U);
+
+  OT::Indices Zs;
+  for (const auto & Z : skeleton_.nodes())
+    if (Z != X && Z != Y && std::find(U.begin(), U.end(), Z) == U.end())
+      Zs.add(Z);
+  const OT::Point IXYZ_U(info.compute3PtCorrectedInformations(X, Y, Zs, U));
+  for (OT::UnsignedInteger i = 0; i < Zs.getSize(); ++i)
+  {
+    ++testsNumber;
+    const double min_pnv_pb = computeContributorProbability(info, X, Y, Zs[i], U, IXY_U, IXYZ_U[i]);
+    if (min_pnv_pb > maxP)
+    {
+      maxP = min_pnv_pb;
+      maxZ = Zs[i];
     }
   }
   TRACE("\tBest contributor: (" << maxZ << ", " << maxP << ")" << std::endl);
+  return std::make_tuple(maxZ, maxP, testsNumber);
+}
 
-  std::pair< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::Indices >*, double > final_pair;
-
+void ContinuousMIIC::insertContributor(const OT::UnsignedInteger X,
+                                       const OT::UnsignedInteger Y,
+                                       const OT::UnsignedInteger maxZ,
+                                       const OT::Indices &U,
+                                       const double maxP)
+{
   if (maxP > -1.0)
   {
-    auto tup = new std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::Indices > {X, Y, maxZ, U};
-    final_pair.first = tup;
-    final_pair.second = maxP;
-    rank_.insert(final_pair);
+    ContributorRecord record;
+    record.X = X;
+    record.Y = Y;
+    record.Z = maxZ;
+    record.U = U;
+    record.score = maxP;
+    rank_.insert(record);
   }
 }
 
+struct ContinuousMIIC_init
+{
+  ContinuousMIIC_init()
+  {
+    // number of iterations between two checkpoints
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousMIIC-CheckpointPeriod", 10);
+    // number of edges evaluated in parallel between two merges of the initiation
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousMIIC-InitiationBatchSize", 64);
+    // number of groups of unshielded triples evaluated in parallel between two merges
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousMIIC-TriplesBatchSize", 64);
+    // number of contributor candidates evaluated by one local copy of the cache
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousMIIC-ContributorsBatchSize", 8);
+  }
+};
+
+static ContinuousMIIC_init __ContinuousMIIC_initializer;
+
 } // namespace OTAGRUM
@@ -0,0 +1,319 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ContinuousMarkovBlanket
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <tuple>
+
+#include "otagrum/ContinuousMarkovBlanket.hxx"
+#include "otagrum/IndicesManip.hxx"
+
+#define TRACE(x)                                                               \
+  {                                                                            \
+    if (verbose_)                                                              \
+      std::cout << x;                                                          \
+  }
+
+namespace OTAGRUM
+{
+
+/**
+ * create a learner of Markov blankets with continuous variables
+ *
+ * @param data : the data
+ * @param maxConditioningSetSize : the size max for the conditioning set in a
+ * independence test
+ * @param alpha : the threshold for the independence test
+ */
+ContinuousMarkovBlanket::ContinuousMarkovBlanket(
+  const OT::Sample &data, const OT::UnsignedInteger maxConditioningSetSize,
+  const double alpha)
+  : OT::Object(), tester_(data, alpha), maxCondSet_(maxConditioningSetSize),
+    verbose_(false), tests_(0)
+{
+}
+
+bool ContinuousMarkovBlanket::isIndep(const OT::UnsignedInteger x,
+                                      const OT::UnsignedInteger y,
+                                      const OT::Indices &z, double &p)
+{
+  double t = 0.0;
+  bool ok = false;
+  ++tests_;
+  std::tie(t, p, ok) = tester_.isIndep(x, y, z);
+  return ok;
+}
+
+/**
+ * max of the p-values of the tests of target and x given the subsets of
+ * conditioning of size up to maxCondSet_ that contain required (the subsets
+ * without it have already been tested). Stops at the first independence.
+ *
+ * @param sepset : the subset giving the max p-value
+ * @return the max p-value
+ */
+double ContinuousMarkovBlanket::maxPValue(const OT::UnsignedInteger target,
+    const OT::UnsignedInteger x,
+    const OT::Indices &conditioning,
+    const OT::Indices &required,
+    OT::Indices &sepset)
+{
+  double pmax = -1.0;
+  if (required.getSize() > maxCondSet_)
+    return pmax;
+  const auto size = std::min<OT::UnsignedInteger>(
+                      conditioning.getSize(), maxCondSet_ - required.getSize());
+  for (OT::UnsignedInteger n = 0; n <= size; ++n)
+  {
+    IndicesCombinationIterator subset(conditioning, n);
+    for (subset.setFirst(); !subset.isLast(); subset.next())
+    {
+      const auto z = required + subset.current();
+      double p = 0.0;
+      const bool indep = isIndep(target, x, z, p);
+      if (p > pmax)
+      {
+        pmax = p;
+        sepset = z;
+      }
+      if (indep)
+        return pmax;
+    }
+  }
+  return pmax;
+}
+
+/**
+ * MMPC : candidate parents and children of target, without the symmetry
+ * correction.
+ *
+ * Forward phase : the candidate with the smallest max p-value given the
+ * subsets of the current set (the strongest minimal association) is added,
+ * the candidates found independent are discarded. Only the subsets containing
+ * the last node added are tested for the remaining candidates. Backward
+ * phase : the nodes independent of target given a subset of the others are
+ * removed.
+ */
+OT::Indices
+ContinuousMarkovBlanket::candidateParentsAndChildren(const OT::UnsignedInteger target)
+{
+  if (cpc_.exists(target))
+    return cpc_[target];
+
+  TRACE("== MMPC of " << target << std::endl);
+  OT::Indices cpc;
+  std::vector<OT::UnsignedInteger> candidates;
+  std::vector<double> pvalues;
+  std::vector<OT::Indices> sepsets;
+  for (OT::UnsignedInteger x = 0; x < tester_.getDimension(); ++x)
+  {
+    if (x == target)
+      continue;
+    candidates.push_back(x);
+    pvalues.push_back(-1.0);
+    sepsets.push_back(OT::Indices());
+  }
+
+  OT::Indices last; // node added at the previous step
+  while (!candidates.empty())
+  {
+    // update the max p-values with the subsets containing the last node
+    OT::UnsignedInteger kept = 0;
+    // the other nodes of cpc, last holding at most one node
+    const OT::Indices others(last.getSize() == 0 ? cpc : cpc - last[0]);
+    for (OT::UnsignedInteger i = 0; i < candidates.size(); ++i)
+    {
+      OT::Indices sep;
+      const double p = maxPValue(target, candidates[i], others, last, sep);
+      if (p > pvalues[i])
+      {
+        pvalues[i] = p;
+        sepsets[i] = sep;
+      }
+      if (pvalues[i] >= tester_.getAlpha())
+      {
+        TRACE("   " << candidates[i] << " removed |" << sepsets[i] << std::endl);
+        sepset_.set(gum::Arc(target, candidates[i]), sepsets[i]);
+        continue;
+      }
+      candidates[kept] = candidates[i];
+      pvalues[kept] = pvalues[i];
+      sepsets[kept] = sepsets[i];
+      ++kept;
+    }
+    candidates.resize(kept);
+    pvalues.resize(kept);
+    sepsets.resize(kept);
+    if (candidates.empty())
+      break;
+
+    // the strongest minimal association
+    const auto best = std::min_element(pvalues.begin(), pvalues.end()) -
+                      pvalues.begin();
+    TRACE("   " << candidates[best] << " added, p=" << pvalues[best]
+          << std::endl);
+    cpc.add(candidates[best]);
+    last = OT::Indices(1, candidates[best]);
+    candidates.erase(candidates.begin() + best);
+    pvalues.erase(pvalues.begin() + best);
+    sepsets.erase(sepsets.begin() + best);
+  }
+
+  // backward phase
+  const OT::Indices forward(cpc);
+  for (const auto x : forward)
+  {
+    OT::Indices sep;
+    const double p = maxPValue(target, x, cpc - x, OT::Indices(), sep);
+    if (p >= tester_.getAlpha())
+    {
+      TRACE("   " << x << " removed (backward) |" << sep << std::endl);
+      sepset_.set(gum::Arc(target, x), sep);
+      cpc = cpc - x;
+    }
+  }
+  cpc_.insert(target, cpc);
+  return cpc;
+}
+
+/**
+ * the nodes x of MMPC(target) such that target is in MMPC(x).
+ */
+OT::Indices
+ContinuousMarkovBlanket::getParentsAndChildren(const OT::UnsignedInteger target)
+{
+  if (target >= tester_.getDimension())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: target " << target << " is not a node, the dimension is "
+        << tester_.getDimension();
+  if (pc_.exists(target))
+    return pc_[target];
+
+  OT::Indices pc;
+  for (const auto x : candidateParentsAndChildren(target))
+  {
+    if (candidateParentsAndChildren(x).contains(target))
+      pc.add(x);
+    else
+      TRACE("   " << x << " removed (symmetry)" << std::endl);
+  }
+  pc_.insert(target, pc);
+  return pc;
+}
+
+/**
+ * y is a spouse of target if there is a child c of target with y in PC(c), y
+ * not adjacent to target, c not in the separator of target and y, and target
+ * and y dependent given this separator and c (v-structure target->c<-y).
+ */
+OT::Indices ContinuousMarkovBlanket::getSpouses(const OT::UnsignedInteger target)
+{
+  const auto pc = getParentsAndChildren(target);
+  OT::Indices spouses;
+  for (const auto c : pc)
+  {
+    for (const auto y : getParentsAndChildren(c))
+    {
+      if (y == target || pc.contains(y) || spouses.contains(y))
+        continue;
+      // the separator found by the MMPC of target, else by the one of y
+      OT::Indices sep;
+      if (sepset_.exists(gum::Arc(target, y)))
+        sep = sepset_[gum::Arc(target, y)];
+      else if (sepset_.exists(gum::Arc(y, target)))
+        sep = sepset_[gum::Arc(y, target)];
+      if (sep.contains(c))
+        continue;
+      double p = 0.0;
+      if (!isIndep(target, y, sep + c, p))
+      {
+        TRACE("   " << y << " spouse through " << c << ", p=" << p
+              << std::endl);
+        spouses.add(y);
+      }
+    }
+  }
+  return spouses;
+}
+
+OT::Indices
+ContinuousMarkovBlanket::getMarkovBlanket(const OT::UnsignedInteger target)
+{
+  OT::Indices blanket(getParentsAndChildren(target) + getSpouses(target));
+  std::sort(blanket.begin(), blanket.end());
+  return blanket;
+}
+
+std::vector<std::string>
+ContinuousMarkovBlanket::getParentsAndChildren(const std::string &target)
+{
+  return namesFromIds(getParentsAndChildren(idFromName(target)));
+}
+
+std::vector<std::string>
+ContinuousMarkovBlanket::getSpouses(const std::string &target)
+{
+  return namesFromIds(getSpouses(idFromName(target)));
+}
+
+std::vector<std::string>
+ContinuousMarkovBlanket::getMarkovBlanket(const std::string &target)
+{
+  return namesFromIds(getMarkovBlanket(idFromName(target)));
+}
+
+OT::UnsignedInteger ContinuousMarkovBlanket::getTestsNumber() const
+{
+  return tests_;
+}
+
+void ContinuousMarkovBlanket::setVerbosity(bool verbose)
+{
+  verbose_ = verbose;
+}
+
+bool ContinuousMarkovBlanket::getVerbosity() const
+{
+  return verbose_;
+}
+
+std::vector<std::string>
+ContinuousMarkovBlanket::namesFromIds(const OT::Indices &ids) const
+{
+  const auto description = tester_.getDataDescription();
+  std::vector<std::string> names;
+  for (const auto id : ids)
+    names.push_back(description[id]);
+  return names;
+}
+
+OT::UnsignedInteger
+ContinuousMarkovBlanket::idFromName(const std::string &name) const
+{
+  const auto description = tester_.getDataDescription();
+  for (OT::UnsignedInteger i = 0; i < description.getSize(); ++i)
+    if (description[i] == name)
+      return i;
+  throw OT::InvalidArgumentException(HERE)
+      << "Error: name '" << name << "' is not a node name.";
+}
+
+} // namespace OTAGRUM
@@ -19,17 +19,36 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
 #include <iomanip>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
 #include <sstream>
 #include <tuple>
 
 #include <agrum/base/core/hashFunc.h>
 #include <agrum/base/core/priorityQueue.h>
+#include <agrum/base/core/timer.h>
 #include <agrum/base/graphs/DAG.h>
 #include <agrum/base/graphs/mixedGraph.h>
 #include <agrum/base/graphs/algorithms/MeekRules.h>
 
+#include <openturns/DistFunc.hxx>
+#include <openturns/ResourceMap.hxx>
+
 #include "otagrum/ContinuousPC.hxx"
+#include "otagrum/IncrementalReachability.hxx"
+#include "otagrum/ProcessPool.hxx"
+#include "otagrum/RankCorrelationScreening.hxx"
 #include "otagrum/Utils.hxx"
 
 #define TRACE(x)                                                               \
@@ -89,6 +108,13 @@ inline std::ostream &operator<<(std::ostream &aStream, const Triplet &i)
 
 namespace OTAGRUM
 {
+// index of the pair of nodes of edge in the flat arrays
+static OT::UnsignedInteger PairIndex(const gum::Edge &edge)
+{
+  const OT::UnsignedInteger second = edge.second();
+  return second * (second - 1) / 2 + edge.first();
+}
+
 /**
  * create an learner using PC algorithm with continuous variables
  *
@@ -101,12 +127,540 @@ ContinuousPC::ContinuousPC(const OT::Sample &data,
                            const OT::UnsignedInteger maxConditioningSetSize,
                            const double alpha)
   : OT::Object(), maxCondSet_(maxConditioningSetSize), verbose_(false),
-    tester_(data), skel_done_(false), pdag_done_(false), dag_done_(false),
-    jt_done_(false)
+    ordering_(SeparatorOrderingTypes::Lexicographic), maxTestsPerEdge_(0),
+    maxTimePerEdge_(0.0), seed_(0), grouped_(false), prefetch_(false),
+    workersNumber_(0), rankScreening_(false), highDimension_(false), testsNumber_(0), memoize_(false), data_(data), tester_(data), warmStart_(false),
+    startLevel_(0), checkpointCache_(false), skel_done_(false), pdag_done_(false), dag_done_(false), jt_done_(false)
 {
   tester_.setAlpha(alpha);
   removed_.reserve(data.getDimension() * data.getDimension() /
                    3); // a rough estimation ...
+  const auto &description = tester_.getDataDescription();
+  for (OT::UnsignedInteger i = 0; i < description.getSize(); ++i)
+    if (!nameIds_.exists(description[i]))
+      nameIds_.insert(description[i], gum::NodeId(i));
+}
+
+/**
+ * create a learner from a previous one, whose data are completed by newRows.
+ *
+ * Only the decisions of previous that are close to alpha are revised : an
+ * edge is unstable if the p-value that decided it is within margin of alpha.
+ * All the edges of previous's skeleton incident to a node of an unstable edge
+ * (and the unstable removed edges) are tested again, from the size 0 of
+ * conditioning sets, on the whole data. The other edges are kept, and the
+ * other removed edges keep their separator and p-value.
+ *
+ * @param previous : the learner of the previous data, with its skeleton learned
+ * @param newRows : the rows appended to the data of previous
+ * @param margin : the distance to alpha under which a decision is revised
+ */
+ContinuousPC::ContinuousPC(const ContinuousPC &previous,
+                           const OT::Sample &newRows, const double margin)
+  : ContinuousPC(previous)
+{
+  if (!previous.skel_done_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the skeleton of the previous learner has not been learned";
+  if (previous.highDimension_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: no warm start from a learner in high-dimension mode";
+  if (newRows.getDimension() != data_.getDimension())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the new rows have dimension " << newRows.getDimension()
+        << ", expected " << data_.getDimension();
+  if (!(margin >= 0.0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the margin must be positive, got " << margin;
+
+  data_.add(newRows);
+  const double alpha = tester_.getAlpha();
+  tester_ = ContinuousTTest(data_, alpha);
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+  initWarmStart(previous, margin);
+}
+
+/**
+ * create a learner resuming the run that wrote checkpointFile (see
+ * setCheckpointFile). The settings of the run are read from the file, and
+ * learnSkeleton continues from the level at which it was written, giving the
+ * same results as the uninterrupted run.
+ *
+ * @param data : the data of the interrupted run
+ * @param checkpointFile : the checkpoint file
+ */
+ContinuousPC::ContinuousPC(const OT::Sample &data,
+                           const std::string &checkpointFile)
+  : ContinuousPC(data)
+{
+  readCheckpoint(checkpointFile);
+}
+
+/**
+ * The edges of skeleton are tested from the size 0 of conditioning sets, the
+ * missing ones are considered removed. Only those given a separator by
+ * setInitialSepset are used to orient the v-structures.
+ */
+void ContinuousPC::setInitialSkeleton(const gum::UndiGraph &skeleton)
+{
+  const OT::UnsignedInteger dimension = tester_.getDimension();
+  if (skeleton.size() != dimension)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the initial skeleton has " << skeleton.size()
+        << " nodes, expected " << dimension;
+  for (gum::NodeId i = 0; i < dimension; ++i)
+    if (!skeleton.existsNode(i))
+      throw OT::InvalidArgumentException(HERE)
+          << "Error: the initial skeleton has no node " << i;
+
+  warmStart_ = true;
+  startLevel_ = 0;
+  initialSkeleton_ = skeleton;
+  initialSepset_.clear();
+  initialPValues_.clear();
+  initialTTests_.clear();
+  initialRemoved_.clear();
+  frozen_.clear();
+  resumedCapped_.clear();
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+void ContinuousPC::setInitialSepset(const gum::NodeId x, const gum::NodeId y,
+                                    const OT::Indices &sepset,
+                                    const double pValue)
+{
+  if (!warmStart_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: no initial skeleton, call setInitialSkeleton first";
+  if (initialSkeleton_.existsEdge(x, y))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << x << "-" << y << " is an edge of the initial skeleton";
+  const gum::Edge edge(x, y);
+  if (!initialSepset_.exists(edge))
+    initialRemoved_.push_back(edge);
+  initialSepset_.set(edge, sepset);
+  initialPValues_.set(edge, pValue);
+  // the t-statistic with this p-value
+  initialTTests_.set(edge, -OT::DistFunc::qNormal(0.5 * pValue));
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+/**
+ * The edge x-y of the initial skeleton is kept without test, for instance
+ * when its neighbours are the ones of a previous run that kept it with
+ * p-value pValue.
+ */
+void ContinuousPC::addFrozenEdge(const gum::NodeId x, const gum::NodeId y,
+                                 const double pValue)
+{
+  if (!warmStart_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: no initial skeleton, call setInitialSkeleton first";
+  if (!initialSkeleton_.existsEdge(x, y))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << x << "-" << y << " is not an edge of the initial skeleton";
+  const gum::Edge edge(x, y);
+  frozen_.insert(edge);
+  initialPValues_.set(edge, pValue);
+  // the t-statistic with this p-value
+  initialTTests_.set(edge, -OT::DistFunc::qNormal(0.5 * pValue));
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+void ContinuousPC::checkNodes(const gum::NodeId x, const gum::NodeId y) const
+{
+  const OT::UnsignedInteger dimension = tester_.getDimension();
+  if ((x >= dimension) || (y >= dimension) || (x == y))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << x << "-" << y << " is not an edge between the "
+        << dimension << " nodes";
+}
+
+/**
+ * A forbidden edge is removed before the test of size 0, without separator :
+ * it is neither in getTrace nor used to orient the v-structures.
+ */
+void ContinuousPC::addForbiddenEdge(const gum::NodeId x, const gum::NodeId y)
+{
+  checkNodes(x, y);
+  const gum::Edge edge(x, y);
+  if (required_.contains(edge))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << x << "-" << y << " is a required edge";
+  forbidden_.insert(edge);
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+void ContinuousPC::addForbiddenEdge(const std::string &x, const std::string &y)
+{
+  addForbiddenEdge(idFromName(x), idFromName(y));
+}
+
+/**
+ * A required edge is never tested : it is kept in the skeleton, and its nodes
+ * remain candidates to separate the other edges.
+ */
+void ContinuousPC::addRequiredEdge(const gum::NodeId x, const gum::NodeId y)
+{
+  checkNodes(x, y);
+  const gum::Edge edge(x, y);
+  if (forbidden_.contains(edge))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << x << "-" << y << " is a forbidden edge";
+  required_.insert(edge);
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+void ContinuousPC::addRequiredEdge(const std::string &x, const std::string &y)
+{
+  addRequiredEdge(idFromName(x), idFromName(y));
+}
+
+/**
+ * The edges between two tiers are oriented from the lower tier to the higher
+ * one before the v-structures. The separators of y and z are only searched
+ * among the nodes whose tier is not higher than both of theirs : the parents
+ * of y or z, which separate them, are in such tiers.
+ */
+void ContinuousPC::setTiers(const OT::Indices &tiers)
+{
+  if ((tiers.getSize() != 0) && (tiers.getSize() != tester_.getDimension()))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << tiers.getSize() << " tiers given, expected "
+        << tester_.getDimension();
+  tiers_ = tiers;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+OT::Indices ContinuousPC::getTiers() const
+{
+  return tiers_;
+}
+
+void ContinuousPC::setCheckpointFile(const std::string &fileName,
+                                     const bool withCache)
+{
+  checkpointFile_ = fileName;
+  checkpointCache_ = withCache;
+}
+
+std::string ContinuousPC::getCheckpointFile() const
+{
+  return checkpointFile_;
+}
+
+static void WriteEdge(std::ostream &os, const gum::Edge &edge)
+{
+  os << edge.first() << ' ' << edge.second();
+}
+
+static gum::Edge ReadEdge(std::istream &is)
+{
+  gum::NodeId x = 0, y = 0;
+  is >> x >> y;
+  return gum::Edge(x, y);
+}
+
+// reads the word expected, and then a count
+static OT::UnsignedInteger ReadSection(std::istream &is,
+                                       const std::string &expected)
+{
+  std::string word;
+  OT::UnsignedInteger count = 0;
+  is >> word >> count;
+  if (!is || (word != expected))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: invalid checkpoint file, expected section " << expected;
+  return count;
+}
+
+/**
+ * Write the state of inferSkeleton before testing the conditioning sets of
+ * size n. The file is first written under a temporary name and then renamed,
+ * so that an interruption while writing keeps the previous checkpoint.
+ */
+void ContinuousPC::writeCheckpoint(const gum::UndiGraph &g,
+                                   OT::UnsignedInteger n) const
+{
+  const std::string tmpFile = checkpointFile_ + ".tmp";
+  {
+    std::ofstream os(tmpFile);
+    if (!os)
+      throw OT::FileOpenException(HERE)
+          << "Error: cannot write the checkpoint file " << tmpFile;
+    os.precision(17);
+    os << "ContinuousPC-checkpoint 2" << std::endl;
+    os << "data " << data_.getDimension() << ' ' << data_.getSize()
+       << std::endl;
+    os << "settings " << maxCondSet_ << ' ' << tester_.getAlpha() << ' '
+       << static_cast<int>(ordering_) << ' ' << maxTestsPerEdge_ << ' '
+       << maxTimePerEdge_ << ' ' << seed_ << ' ' << grouped_ << ' '
+       << prefetch_ << std::endl;
+    os << "forbidden " << forbidden_.size() << std::endl;
+    for (const auto &edge : forbidden_)
+    {
+      WriteEdge(os, edge);
+      os << std::endl;
+    }
+    os << "required " << required_.size() << std::endl;
+    for (const auto &edge : required_)
+    {
+      WriteEdge(os, edge);
+      os << std::endl;
+    }
+    os << "tiers " << tiers_.getSize();
+    for (const auto tier : tiers_)
+      os << ' ' << tier;
+    os << std::endl;
+    os << "level " << n << std::endl;
+
+    os << "edges " << g.sizeEdges() << std::endl;
+    for (const auto &edge : g.edges())
+    {
+      WriteEdge(os, edge);
+      os << ' ' << frozen_.contains(edge) << ' '
+         << pvalues_.getWithDefault(edge, 0.0) << ' '
+         << ttests_.getWithDefault(edge, -10000) << ' '
+         << pvalues_.exists(edge) << std::endl;
+    }
+
+    os << "removed " << removed_.size() << std::endl;
+    for (const auto &edge : removed_)
+    {
+      WriteEdge(os, edge);
+      os << ' ' << pvalues_[edge] << ' ' << ttests_[edge] << ' '
+         << sepset_[edge].getSize();
+      for (const auto x : sepset_[edge])
+        os << ' ' << x;
+      os << std::endl;
+    }
+
+    os << "capped " << capped_.size() << std::endl;
+    for (const auto &edge : capped_)
+    {
+      WriteEdge(os, edge);
+      os << std::endl;
+    }
+
+    if (checkpointCache_)
+    {
+      os << "cache ";
+      tester_.writeCache(os);
+    }
+    else
+      os << "cache 0" << std::endl;
+
+    if (!os)
+      throw OT::FileOpenException(HERE)
+          << "Error: cannot write the checkpoint file " << tmpFile;
+  }
+  if (std::rename(tmpFile.c_str(), checkpointFile_.c_str()) != 0)
+    throw OT::FileOpenException(HERE)
+        << "Error: cannot write the checkpoint file " << checkpointFile_;
+  TRACE("==  checkpoint written in " << checkpointFile_ << std::endl);
+}
+
+void ContinuousPC::readCheckpoint(const std::string &fileName)
+{
+  std::ifstream is(fileName);
+  if (!is)
+    throw OT::FileNotFoundException(HERE)
+        << "Error: cannot read the checkpoint file " << fileName;
+
+  std::string word;
+  int version = 0;
+  is >> word >> version;
+  if (word != "ContinuousPC-checkpoint" || version < 1 || version > 2)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: " << fileName << " is not a ContinuousPC checkpoint file";
+
+  OT::UnsignedInteger dimension = 0, size = 0;
+  is >> word >> dimension >> size;
+  if ((dimension != data_.getDimension()) || (size != data_.getSize()))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the checkpoint has been written for data of dimension "
+        << dimension << " and size " << size << ", got "
+        << data_.getDimension() << " and " << data_.getSize();
+
+  double alpha = 0.0;
+  int ordering = 0;
+  is >> word >> maxCondSet_ >> alpha >> ordering >> maxTestsPerEdge_ >>
+     maxTimePerEdge_ >> seed_ >> grouped_ >> prefetch_;
+  tester_.setAlpha(alpha);
+  ordering_ = static_cast<SeparatorOrderingTypes>(ordering);
+  // the background knowledge has been added by the version 2
+  if (version >= 2)
+  {
+    forbidden_.clear();
+    const auto forbidden = ReadSection(is, "forbidden");
+    for (OT::UnsignedInteger i = 0; i < forbidden; ++i)
+      forbidden_.insert(ReadEdge(is));
+    required_.clear();
+    const auto required = ReadSection(is, "required");
+    for (OT::UnsignedInteger i = 0; i < required; ++i)
+      required_.insert(ReadEdge(is));
+    tiers_ = OT::Indices(ReadSection(is, "tiers"));
+    for (OT::UnsignedInteger i = 0; i < tiers_.getSize(); ++i)
+      is >> tiers_[i];
+  }
+  is >> word >> startLevel_;
+
+  initialSkeleton_.clear();
+  for (gum::NodeId i = 0; i < dimension; ++i)
+    initialSkeleton_.addNodeWithId(i);
+  initialSepset_.clear();
+  initialPValues_.clear();
+  initialTTests_.clear();
+  initialRemoved_.clear();
+  frozen_.clear();
+
+  const auto edges = ReadSection(is, "edges");
+  for (OT::UnsignedInteger i = 0; i < edges; ++i)
+  {
+    const auto edge = ReadEdge(is);
+    bool frozen = false, tested = false;
+    double p = 0.0, t = 0.0;
+    is >> frozen >> p >> t >> tested;
+    initialSkeleton_.addEdge(edge.first(), edge.second());
+    if (frozen)
+      frozen_.insert(edge);
+    if (tested)
+    {
+      initialPValues_.set(edge, p);
+      initialTTests_.set(edge, t);
+    }
+  }
+
+  const auto removed = ReadSection(is, "removed");
+  for (OT::UnsignedInteger i = 0; i < removed; ++i)
+  {
+    const auto edge = ReadEdge(is);
+    double p = 0.0, t = 0.0;
+    OT::UnsignedInteger sepSize = 0;
+    is >> p >> t >> sepSize;
+    OT::Indices sep(sepSize);
+    for (OT::UnsignedInteger j = 0; j < sepSize; ++j)
+      is >> sep[j];
+    initialRemoved_.push_back(edge);
+    initialSepset_.set(edge, sep);
+    initialPValues_.set(edge, p);
+    initialTTests_.set(edge, t);
+  }
+
+  // the capped edges are also known from the previous levels
+  const auto capped = ReadSection(is, "capped");
+  for (OT::UnsignedInteger i = 0; i < capped; ++i)
+    resumedCapped_.insert(ReadEdge(is));
+
+  is >> word;
+  if (!is || (word != "cache"))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: invalid checkpoint file, expected section cache";
+  tester_.readCache(is);
+
+  if (!is)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: cannot read the checkpoint file " << fileName;
+  warmStart_ = true;
+}
+
+void ContinuousPC::initWarmStart(const ContinuousPC &previous,
+                                 const double margin)
+{
+  const double alpha = tester_.getAlpha();
+  const auto &skeleton = previous.skel_;
+
+  // the nodes of the unstable decisions
+  gum::NodeSet touched;
+  gum::EdgeSet reopened;
+  for (const auto &edge : previous.removed_)
+  {
+    if (previous.pvalues_[edge] - alpha < margin)
+    {
+      reopened.insert(edge);
+      touched.insert(edge.first());
+      touched.insert(edge.second());
+    }
+  }
+  for (const auto &edge : skeleton.edges())
+  {
+    if (alpha - previous.pvalues_.getWithDefault(edge, 0.0) < margin)
+    {
+      touched.insert(edge.first());
+      touched.insert(edge.second());
+    }
+  }
+
+  warmStart_ = true;
+  startLevel_ = 0;
+  resumedCapped_.clear();
+  initialSkeleton_ = skeleton;
+  initialSepset_.clear();
+  initialPValues_.clear();
+  initialTTests_.clear();
+  initialRemoved_.clear();
+  frozen_.clear();
+  for (const auto &edge : reopened)
+    initialSkeleton_.addEdge(edge.first(), edge.second());
+  for (const auto &edge : initialSkeleton_.edges())
+  {
+    // the required edges were never tested : they are kept by the constraints
+    if (required_.contains(edge) || !previous.pvalues_.exists(edge))
+      continue;
+    if (!touched.contains(edge.first()) && !touched.contains(edge.second()))
+    {
+      frozen_.insert(edge);
+      initialPValues_.set(edge, previous.pvalues_[edge]);
+      initialTTests_.set(edge, previous.ttests_[edge]);
+    }
+  }
+  for (const auto &edge : previous.removed_)
+  {
+    if (reopened.contains(edge))
+      continue;
+    initialRemoved_.push_back(edge);
+    initialSepset_.set(edge, previous.sepset_[edge]);
+    initialPValues_.set(edge, previous.pvalues_[edge]);
+    initialTTests_.set(edge, previous.ttests_[edge]);
+  }
+}
+
+// min(C(n, k), bound + 1), without overflow for large n
+static OT::UnsignedInteger BinomialUpTo(const OT::UnsignedInteger n,
+                                        const OT::UnsignedInteger k,
+                                        const OT::UnsignedInteger bound)
+{
+  // computed in floating point : c * (n - k + i) may not fit in an integer
+  double c = 1.0;
+  for (OT::UnsignedInteger i = 1; i <= k; ++i)
+  {
+    // c = C(n - k + i, i) is increasing with i
+    c = std::round(c * (n - k + i) / i);
+    if (c > bound)
+      return bound + 1;
+  }
+  return OT::UnsignedInteger(c);
 }
 
 /**
@@ -118,16 +672,23 @@ ContinuousPC::ContinuousPC(const OT::Sample &data,
  * @param z : and the node z to separate
  * @param neighbours : the nodes X which separate
  * @param n : the size of separators
+ * @param capped : set to true if the search has been stopped by the per-edge
+ * budget before all the candidates have been tested
  * @return a std:tuple of (isIndep,ttestvalue,proba,sep).
  * Note that if proba=0, then no separator have been found
  *
  * @warning when optimalPolicy is set, the pair is the one with the best
  * p-value. Otherwise, it is the first one
+ *
+ * The candidates are enumerated in lexicographic order, or sorted by
+ * rankSeparators when the heuristic ordering is set. If there are more
+ * candidates than maxTestsPerEdge_, only maxTestsPerEdge_ of them, randomly
+ * chosen, are tested, in the heuristic order if it is set.
  */
 std::tuple<bool, double, double, OT::Indices>
 ContinuousPC::getSeparator(const gum::UndiGraph & /*g*/, gum::NodeId y,
                            gum::NodeId z, const OT::Indices &neighbours,
-                           OT::UnsignedInteger n) const
+                           OT::UnsignedInteger n, bool &capped) const
 {
   double t = 0.0;
   double p = 0.0;
@@ -136,94 +697,877 @@ ContinuousPC::getSeparator(const gum::UndiGraph & /*g*/, gum::NodeId y,
   bool ok = false;
 
   const OT::Indices nullsep;
+  capped = false;
+  gum::Timer timer;
+  timer.reset();
 
-  IndicesCombinationIterator separator(neighbours, n);
-  for (separator.setFirst(); !separator.isLast(); separator.next())
+  // returns true if sep separates y and z
+  auto testSeparator = [&](const OT::Indices & sep)
   {
-    std::tie(t, p, ok) = tester_.isIndep(y, z, separator.current());
+    std::tie(t, p, ok) = isIndep(y, z, sep);
     if (!ok)
     {
-      TRACE(TRACE_EDGE((y), (z))
-            << "     |" << separator.current() << ", pvalue=" << p << "\n");
+      TRACE(TRACE_EDGE((y), (z)) << "     |" << sep << ", pvalue=" << p << "\n");
     }
     else
     {
-      return std::make_tuple(true, t, p, separator.current());
+      return true;
     }
     if (p > pmax)
     {
       pmax = p;
       tmax = t;
     }
+    return false;
+  };
+  // returns true if the time budget is exhausted
+  auto outOfTime = [&]()
+  {
+    if ((maxTimePerEdge_ > 0.0) && (timer.step() > maxTimePerEdge_))
+    {
+      TRACE(TRACE_EDGE((y), (z)) << "     | time budget exhausted\n");
+      capped = true;
+    }
+    return capped;
+  };
+
+  if ((maxTestsPerEdge_ > 0) &&
+      (BinomialUpTo(neighbours.getSize(), n, maxTestsPerEdge_) >
+       maxTestsPerEdge_))
+  {
+    TRACE(TRACE_EDGE((y), (z)) << "     | too many candidates, sampling "
+          << maxTestsPerEdge_ << " of them\n");
+    capped = true;
+    auto candidates = sampleSeparators(y, z, neighbours, n, maxTestsPerEdge_);
+    if (ordering_ == SeparatorOrderingTypes::Heuristic)
+      sortSeparators(y, z, neighbours, candidates);
+    for (const auto &sep : candidates)
+    {
+      if (testSeparator(sep))
+        return std::make_tuple(true, t, p, sep);
+      if ((maxTimePerEdge_ > 0.0) && (timer.step() > maxTimePerEdge_))
+        break;
+    }
+    return std::make_tuple(false, tmax, pmax, nullsep);
+  }
+
+  if (ordering_ == SeparatorOrderingTypes::Heuristic)
+  {
+    for (const auto &sep : rankSeparators(y, z, neighbours, n))
+    {
+      if (testSeparator(sep))
+        return std::make_tuple(true, t, p, sep);
+      if (outOfTime())
+        break;
+    }
+    return std::make_tuple(false, tmax, pmax, nullsep);
+  }
+
+  IndicesCombinationIterator separator(neighbours, n);
+  for (separator.setFirst(); !separator.isLast(); separator.next())
+  {
+    if (testSeparator(separator.current()))
+      return std::make_tuple(true, t, p, separator.current());
+    if (outOfTime())
+      break;
+  }
+  return std::make_tuple(false, tmax, pmax, nullsep);
+}
+
+/**
+ * Draw size distinct candidate separators of size n among neighbours.
+ *
+ * The random generator is seeded from seed_, the edge and n so that the
+ * sampled candidates do not depend on the order in which the edges are
+ * processed.
+ */
+std::vector<OT::Indices>
+ContinuousPC::sampleSeparators(gum::NodeId y, gum::NodeId z,
+                               const OT::Indices &neighbours,
+                               OT::UnsignedInteger n,
+                               OT::UnsignedInteger size) const
+{
+  const gum::Edge edge(y, z);
+  std::seed_seq seq{std::uint64_t(seed_), std::uint64_t(edge.first()),
+                    std::uint64_t(edge.second()), std::uint64_t(n)};
+  std::mt19937_64 generator(seq);
+
+  const OT::UnsignedInteger m = neighbours.getSize();
+  std::vector<OT::UnsignedInteger> positions(m);
+  std::set<std::vector<OT::UnsignedInteger>> drawn;
+  std::vector<OT::Indices> res;
+  res.reserve(size);
+
+  // the number of candidates is larger than size, the bound on the number of
+  // draws only protects against pathological generators
+  for (OT::UnsignedInteger draw = 0; (res.size() < size) && (draw < 10 * size);
+       ++draw)
+  {
+    // partial Fisher-Yates shuffle
+    std::iota(positions.begin(), positions.end(), 0);
+    for (OT::UnsignedInteger i = 0; i < n; ++i)
+    {
+      const OT::UnsignedInteger j = i + generator() % (m - i);
+      std::swap(positions[i], positions[j]);
+    }
+    std::vector<OT::UnsignedInteger> subset(positions.begin(),
+                                            positions.begin() + n);
+    std::sort(subset.begin(), subset.end());
+    if (!drawn.insert(subset).second)
+      continue;
+
+    OT::Indices sep;
+    for (const auto pos : subset)
+      sep.add(neighbours[pos]);
+    res.push_back(sep);
+  }
+  return res;
+}
+
+/**
+ * Sort the candidate separators of size n for y and z, the most likely
+ * first (see sortSeparators).
+ */
+std::vector<OT::Indices>
+ContinuousPC::rankSeparators(gum::NodeId y, gum::NodeId z,
+                             const OT::Indices &neighbours,
+                             OT::UnsignedInteger n) const
+{
+  std::vector<OT::Indices> res;
+  IndicesCombinationIterator separator(neighbours, n);
+  for (separator.setFirst(); !separator.isLast(); separator.next())
+    res.push_back(separator.current());
+  sortSeparators(y, z, neighbours, res);
+  return res;
+}
+
+/**
+ * Sort the candidate separators for y and z taken among neighbours, the most
+ * likely first.
+ *
+ * The score of a candidate is the sum over its nodes x of
+ * min(association(x,y), association(x,z)), where the association is the
+ * absolute t-statistic recorded before the current level : a separator is
+ * expected to be strongly dependent on both y and z. The candidates with
+ * nodes of unknown association come last, ties keep the given order.
+ */
+void ContinuousPC::sortSeparators(gum::NodeId y, gum::NodeId z,
+                                  const OT::Indices &neighbours,
+                                  std::vector<OT::Indices> &separators) const
+{
+  std::vector<double> nodeScores(neighbours.getSize());
+  for (OT::UnsignedInteger i = 0; i < neighbours.getSize(); ++i)
+  {
+    nodeScores[i] = std::min(getAssociation(neighbours[i], y),
+                             getAssociation(neighbours[i], z));
+  }
+
+  // (number of unknown associations, score) of each candidate
+  struct Candidate
+  {
+    OT::UnsignedInteger unknown;
+    double score;
+    OT::Indices separator;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(separators.size());
+  for (auto &separator : separators)
+  {
+    Candidate candidate = {0, 0.0, std::move(separator)};
+    for (const auto x : candidate.separator)
+    {
+      const double score = nodeScores[neighbours.find(x)];
+      if (score == -std::numeric_limits<double>::infinity())
+        ++candidate.unknown;
+      else
+        candidate.score += score;
+    }
+    candidates.push_back(std::move(candidate));
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const Candidate & a, const Candidate & b)
+  {
+    if (a.unknown != b.unknown)
+      return a.unknown < b.unknown;
+    return a.score > b.score;
+  });
+
+  for (OT::UnsignedInteger i = 0; i < candidates.size(); ++i)
+    separators[i] = std::move(candidates[i].separator);
+}
+
+// strength of the dependence between x and y found at the previous levels
+// (-inf if unknown)
+double ContinuousPC::getAssociation(gum::NodeId x, gum::NodeId y) const
+{
+  const gum::Edge e(x, y);
+  if (levelTTests_.exists(e))
+    return std::abs(levelTTests_[e]);
+  if (isPairRemoved(e))
+    return std::abs(pairTTests_[PairIndex(e)]);
+  return -std::numeric_limits<double>::infinity();
+}
+
+//
+/**
+ * test all possible separator set of size n in graph g if a possible
+ * separator set X is found for y,z then the edge is removed and the separator
+ * is kept in sepset_
+ *
+ * @param g : the graph
+ * @param n : the size of searched separators (beginning with n=0)
+ * @param prefetch : if not null, where to start the computation of the
+ * log-pdfs of the level n+1 when most of the edges have been tested
+ * @return true if at least one separator has been found (if an edge has been
+ * cut)
+ */
+bool ContinuousPC::testCondSetWithSize(gum::UndiGraph &g,
+                                       OT::UnsignedInteger n,
+                                       std::future<PrefetchedLogPDFs> *prefetch)
+{
+  if (g.sizeEdges() == 0)
+    return false;
+
+  // the ordering does not depend on the order in which the edges are tested
+  levelTTests_ = ttests_;
+  bool atLeastOneInThisStep = false;
+  gum::EdgeProperty<gum::NodeSet> intersections;
+  for (const auto &edge : g.edges())
+  {
+    if (isFrozen(edge))
+      continue;
+    const auto nei = getCandidates(g, edge.first(), edge.second());
+    if (nei.size() >= n)
+      intersections.set(edge, nei);
+  }
+
+  if (workersNumber_ > 0)
+    return testCondSetWithSizeWorkers(g, n, intersections);
+  if (grouped_)
+    return testCondSetWithSizeGrouped(g, n, intersections);
+
+  const OT::UnsignedInteger prefetchAfter = OT::UnsignedInteger(
+        OT::ResourceMap::GetAsScalar("ContinuousPC-PrefetchThreshold") *
+        intersections.size());
+  OT::UnsignedInteger tested = 0;
+
+  gum::EdgeSet edgeset = g.edges();
+  for (const auto &edge : edgeset)
+  {
+    if (!intersections.exists(edge))
+    {
+      continue;
+    }
+    // the edges not tested yet are kept
+    if (control_.report("skeleton", n, intersections.size() - tested,
+                        testsNumber_))
+      break;
+    if ((prefetch != nullptr) && (tested >= prefetchAfter) &&
+        !prefetch->valid())
+      *prefetch = startPrefetch(g, n);
+    ++tested;
+
+    const auto &nei = intersections[edge];
+    const auto y = edge.first();
+    const auto z = edge.second();
+    bool resYZ = false;
+    double pYZ = 0.0, tYZ = 0.0;
+    OT::Indices sepYZ;
+
+    bool cappedYZ = false;
+
+    std::tie(resYZ, tYZ, pYZ, sepYZ) =
+      getSeparator(g, y, z, Utils::FromNodeSet(nei), n, cappedYZ);
+    if (cappedYZ)
+      capped_.insert(edge);
+
+    if (storeSearchResult(g, edge, resYZ, tYZ, pYZ, sepYZ))
+      atLeastOneInThisStep = true;
+  }
+
+  return atLeastOneInThisStep;
+}
+
+/**
+ * Same as testCondSetWithSize, but the (edge, X) tests are run grouped by
+ * conditioning set X instead of edge by edge.
+ *
+ * For a given level, the densities X, X+y, X+z and X+y+z needed by a test
+ * only depend on X, so they are computed when the group of X is processed
+ * and released from the cache as soon as it is finished. For each edge, the
+ * separator kept is still the first one in the order of its candidates :
+ * the candidates after a separator already found are skipped, the ones
+ * before it are still tested. The results are then the same as edge by edge
+ * (the heuristic ordering uses the statistics known at the beginning of the
+ * level).
+ */
+bool ContinuousPC::testCondSetWithSizeGrouped(
+  gum::UndiGraph &g, OT::UnsignedInteger n,
+  const gum::EdgeProperty<gum::NodeSet> &intersections)
+{
+  struct EdgeSearch
+  {
+    gum::Edge edge;
+    std::vector<OT::Indices> candidates;
+    bool found;
+    OT::UnsignedInteger first; // rank of the separator found
+    double t, p;
+    double tmax, pmax;
+    OT::UnsignedInteger kmax; // rank of the candidate with the best p-value
+    double elapsed;
+    bool capped;
+  };
+
+  bool atLeastOneInThisStep = false;
+  std::vector<EdgeSearch> searches;
+  // the edges with too many candidates are searched by sampling
+  gum::EdgeSet sampled;
+  // the groups in order of first appearance
+  std::vector<std::vector<std::pair<OT::UnsignedInteger, OT::UnsignedInteger>>>
+      groups;
+  gum::HashTable<std::string, OT::UnsignedInteger> groupOf;
+
+  gum::EdgeSet edgeset = g.edges();
+  for (const auto &edge : edgeset)
+  {
+    if (!intersections.exists(edge))
+      continue;
+    const auto neighbours = Utils::FromNodeSet(intersections[edge]);
+    if ((maxTestsPerEdge_ > 0) &&
+        (BinomialUpTo(neighbours.getSize(), n, maxTestsPerEdge_) >
+         maxTestsPerEdge_))
+    {
+      sampled.insert(edge);
+      continue;
+    }
+
+    EdgeSearch search{edge, {}, false, 0, 0.0, 0.0, 0.0, -1.0, 0, 0.0, false};
+    if (ordering_ == SeparatorOrderingTypes::Heuristic)
+    {
+      search.candidates = rankSeparators(edge.first(), edge.second(), neighbours, n);
+    }
+    else
+    {
+      IndicesCombinationIterator separator(neighbours, n);
+      for (separator.setFirst(); !separator.isLast(); separator.next())
+        search.candidates.push_back(separator.current());
+    }
+
+    const OT::UnsignedInteger index = searches.size();
+    for (OT::UnsignedInteger k = 0; k < search.candidates.size(); ++k)
+    {
+      const auto key = search.candidates[k].__str__();
+      if (!groupOf.exists(key))
+      {
+        groupOf.insert(key, groups.size());
+        groups.emplace_back();
+      }
+      groups[groupOf[key]].emplace_back(index, k);
+    }
+    searches.push_back(std::move(search));
+  }
+
+  TRACE("==  " << groups.size() << " conditioning sets for "
+        << searches.size() << " edges" << std::endl);
+
+  gum::Timer timer;
+  OT::UnsignedInteger remaining = groups.size();
+  for (const auto &group : groups)
+  {
+    // the candidates not tested yet are skipped
+    if (control_.report("skeleton", n, remaining, testsNumber_))
+      break;
+    --remaining;
+    for (const auto &work : group)
+    {
+      auto &search = searches[work.first];
+      const auto k = work.second;
+      // a previous candidate already separates
+      if (search.found && (search.first < k))
+        continue;
+      if (search.capped)
+        continue;
+
+      const auto y = search.edge.first();
+      const auto z = search.edge.second();
+      const auto &sep = search.candidates[k];
+      double t = 0.0, p = 0.0;
+      bool ok = false;
+      timer.reset();
+      std::tie(t, p, ok) = isIndep(y, z, sep);
+      search.elapsed += timer.step();
+      if (ok)
+      {
+        search.found = true;
+        search.first = k;
+        search.t = t;
+        search.p = p;
+      }
+      else
+      {
+        TRACE(TRACE_EDGE((y), (z)) << "     |" << sep << ", pvalue=" << p << "\n");
+        if ((p > search.pmax) || ((p == search.pmax) && (k < search.kmax)))
+        {
+          search.pmax = p;
+          search.tmax = t;
+          search.kmax = k;
+        }
+      }
+      if ((maxTimePerEdge_ > 0.0) && (search.elapsed > maxTimePerEdge_) &&
+          !search.found)
+      {
+        TRACE(TRACE_EDGE((y), (z)) << "     | time budget exhausted\n");
+        search.capped = true;
+      }
+    }
+    // no other group needs the densities of this one
+    for (const auto &work : group)
+    {
+      const auto &search = searches[work.first];
+      tester_.releaseLogPDFs(search.edge.first(), search.edge.second(),
+                             search.candidates[work.second]);
+    }
+  }
+
+  // merge the results in the order of the edges
+  OT::UnsignedInteger index = 0;
+  for (const auto &edge : edgeset)
+  {
+    if (!intersections.exists(edge))
+      continue;
+
+    bool found = false;
+    double t = 0.0, p = 0.0;
+    OT::Indices sep;
+    if (sampled.contains(edge))
+    {
+      if (control_.isInterrupted())
+        continue;
+      bool capped = false;
+      std::tie(found, t, p, sep) =
+        getSeparator(g, edge.first(), edge.second(),
+                     Utils::FromNodeSet(intersections[edge]), n, capped);
+      if (capped)
+        capped_.insert(edge);
+    }
+    else
+    {
+      const auto &search = searches[index];
+      ++index;
+      found = search.found;
+      if (found)
+      {
+        t = search.t;
+        p = search.p;
+        sep = search.candidates[search.first];
+      }
+      else
+      {
+        t = search.tmax;
+        p = search.pmax;
+      }
+      if (search.capped)
+        capped_.insert(edge);
+    }
+
+    if (storeSearchResult(g, edge, found, t, p, sep))
+      atLeastOneInThisStep = true;
+  }
+
+  return atLeastOneInThisStep;
+}
+
+// the bits of a double, written as an integer to be read back exactly
+static void WriteScalar(std::ostream &os, const double x)
+{
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &x, sizeof(x));
+  os << bits;
+}
+
+static double ReadScalar(std::istream &is)
+{
+  std::uint64_t bits = 0;
+  is >> bits;
+  double x = 0.0;
+  std::memcpy(&x, &bits, sizeof(x));
+  return x;
+}
+
+/**
+ * Same as testCondSetWithSize, but the search of the separators of the edges
+ * is run in worker processes (see ProcessPool).
+ *
+ * The edges are sent by batches of ContinuousPC-WorkersBatchSize, with their
+ * candidate nodes, to the free workers. The workers are forked at the
+ * beginning of the level, when no other thread runs (the prefetch is disabled
+ * with the workers and the TBB pool has one thread), so they read the data and
+ * the cache of log-pdfs of the
+ * learner without copying them. The log-pdfs they compute are only kept in
+ * their own cache, for the next batches of the level : the next levels need
+ * other ones. The results are then stored in the order of the edges,
+ * whatever the worker that computed them : they are the same as edge by edge
+ * (the heuristic ordering uses the statistics known at the beginning of the
+ * level).
+ */
+bool ContinuousPC::testCondSetWithSizeWorkers(
+  gum::UndiGraph &g, OT::UnsignedInteger n,
+  const gum::EdgeProperty<gum::NodeSet> &intersections)
+{
+  std::vector<gum::Edge> edges;
+  for (const auto &edge : g.edges())
+    if (intersections.exists(edge))
+      edges.push_back(edge);
+  if (edges.empty())
+    return false;
+
+  const OT::UnsignedInteger batchSize = std::max<OT::UnsignedInteger>(
+                                          1, OT::ResourceMap::GetAsUnsignedInteger("ContinuousPC-WorkersBatchSize"));
+  std::vector<std::string> requests;
+  for (OT::UnsignedInteger start = 0; start < edges.size(); start += batchSize)
+  {
+    const OT::UnsignedInteger end = std::min<OT::UnsignedInteger>(edges.size(), start + batchSize);
+    std::ostringstream request;
+    request << end - start;
+    for (OT::UnsignedInteger i = start; i < end; ++i)
+    {
+      const auto neighbours = Utils::FromNodeSet(intersections[edges[i]]);
+      request << ' ' << edges[i].first() << ' ' << edges[i].second() << ' '
+              << neighbours.getSize();
+      for (const auto x : neighbours)
+        request << ' ' << x;
+    }
+    requests.push_back(request.str());
+  }
+
+  const OT::UnsignedInteger workersNumber = std::min<OT::UnsignedInteger>(workersNumber_, requests.size());
+  TRACE("==  " << edges.size() << " edges in " << requests.size()
+        << " batches for " << workersNumber << " worker processes"
+        << std::endl);
+
+  // run in the workers, on their copy of g and of the learner
+  const auto job = [this, &g, n](const std::string & request)
+  {
+    std::istringstream is(request);
+    std::ostringstream os;
+    const OT::UnsignedInteger testsBefore = testsNumber_;
+    OT::UnsignedInteger count = 0;
+    is >> count;
+    for (OT::UnsignedInteger i = 0; i < count; ++i)
+    {
+      gum::NodeId y = 0, z = 0;
+      OT::UnsignedInteger size = 0;
+      is >> y >> z >> size;
+      OT::Indices neighbours(size);
+      for (OT::UnsignedInteger j = 0; j < size; ++j)
+        is >> neighbours[j];
+
+      bool found = false, capped = false;
+      double t = 0.0, p = 0.0;
+      OT::Indices sep;
+      std::tie(found, t, p, sep) = getSeparator(g, y, z, neighbours, n, capped);
+      os << found << ' ';
+      WriteScalar(os, t);
+      os << ' ';
+      WriteScalar(os, p);
+      os << ' ' << capped << ' ' << sep.getSize();
+      for (const auto x : sep)
+        os << ' ' << x;
+      os << '\n';
+    }
+    // the tests done by the worker are counted by the coordinator
+    return std::to_string(testsNumber_ - testsBefore) + '\n' + os.str();
+  };
+
+  std::vector<std::string> responses;
+  {
+    ProcessPool pool(workersNumber, job);
+    responses = pool.run(requests);
+  }
+
+  // merge the results in the order of the edges
+  bool atLeastOneInThisStep = false;
+  OT::UnsignedInteger index = 0;
+  for (const auto &response : responses)
+  {
+    std::istringstream is(response);
+    OT::UnsignedInteger tests = 0;
+    is >> tests;
+    testsNumber_ += tests;
+    const OT::UnsignedInteger end = std::min<OT::UnsignedInteger>(edges.size(), index + batchSize);
+    for (; index < end; ++index)
+    {
+      bool found = false, capped = false;
+      OT::UnsignedInteger size = 0;
+      is >> found;
+      const double t = ReadScalar(is);
+      const double p = ReadScalar(is);
+      is >> capped >> size;
+      OT::Indices sep(size);
+      for (OT::UnsignedInteger j = 0; j < size; ++j)
+        is >> sep[j];
+      if (!is)
+        throw OT::InternalException(HERE)
+            << "Error: invalid response of a worker process";
+
+      const auto &edge = edges[index];
+      if (capped)
+        capped_.insert(edge);
+      if (storeSearchResult(g, edge, found, t, p, sep))
+        atLeastOneInThisStep = true;
+    }
+  }
+
+  return atLeastOneInThisStep;
+}
+
+/**
+ * Start the computation, in the background, of the log-pdfs that the tests of
+ * the level n+1 will need.
+ *
+ * The edges of g are taken by increasing p-value, i.e. the most likely to
+ * survive the level n first. For each of them, the sets X, X+y, X+z and X+y+z
+ * of its first candidate separators of size n+1 are computed, unless they are
+ * already in the cache. The number of log-pdfs is bounded by
+ * ContinuousPC-MaximumPrefetchSize.
+ *
+ * The task only reads the data of tester_ : the cache is updated by
+ * collectPrefetch.
+ */
+std::future<ContinuousPC::PrefetchedLogPDFs>
+ContinuousPC::startPrefetch(const gum::UndiGraph &g, OT::UnsignedInteger n) const
+{
+  const OT::UnsignedInteger maximumSize =
+    OT::ResourceMap::GetAsUnsignedInteger("ContinuousPC-MaximumPrefetchSize");
+
+  std::vector<std::pair<double, gum::Edge>> edges;
+  for (const auto &edge : g.edges())
+    if (!isFrozen(edge))
+      edges.emplace_back(pvalues_.exists(edge) ? pvalues_[edge] : 0.0, edge);
+  std::stable_sort(edges.begin(), edges.end(),
+                   [](const std::pair<double, gum::Edge> &a,
+                      const std::pair<double, gum::Edge> &b)
+  {
+    return a.first < b.first;
+  });
+
+  PrefetchedLogPDFs prefetched;
+  prefetched.k = tester_.getK(n + 1);
+  std::set<std::string> queued;
+  auto enqueue = [&](const OT::Indices & l)
+  {
+    if (tester_.isCached(l, prefetched.k))
+      return;
+    if (queued.insert(l.__str__()).second)
+      prefetched.sets.push_back(l);
+  };
+
+  for (const auto &elt : edges)
+  {
+    if (prefetched.sets.size() >= maximumSize)
+      break;
+    const auto y = elt.second.first();
+    const auto z = elt.second.second();
+    const auto nei = getCandidates(g, y, z);
+    if (nei.size() < n + 1)
+      continue;
+
+    std::vector<OT::Indices> candidates;
+    if (ordering_ == SeparatorOrderingTypes::Heuristic)
+    {
+      candidates = rankSeparators(y, z, Utils::FromNodeSet(nei), n + 1);
+    }
+    else
+    {
+      IndicesCombinationIterator separator(Utils::FromNodeSet(nei), n + 1);
+      for (separator.setFirst();
+           !separator.isLast() && (candidates.size() < maximumSize);
+           separator.next())
+        candidates.push_back(separator.current());
+    }
+    for (const auto &X : candidates)
+    {
+      if (prefetched.sets.size() >= maximumSize)
+        break;
+      enqueue(X);
+      enqueue(X + y);
+      enqueue(X + z);
+      enqueue(X + y + z);
+    }
+  }
+
+  TRACE("==  prefetching " << prefetched.sets.size()
+        << " log-pdfs for size " << n + 1 << std::endl);
+
+  const ContinuousTTest *tester = &tester_;
+  return std::async(std::launch::async,
+                    [tester](PrefetchedLogPDFs result)
+  {
+    result.logPDFs = tester->computeLogPDFs(result.sets, result.k);
+    return result;
+  }, std::move(prefetched));
+}
+
+// wait for the prefetch task, if any, and store its log-pdfs in the cache
+void ContinuousPC::collectPrefetch(std::future<PrefetchedLogPDFs> &prefetch)
+{
+  if (!prefetch.valid())
+    return;
+  const auto prefetched = prefetch.get();
+  tester_.storeLogPDFs(prefetched.sets, prefetched.k, prefetched.logPDFs);
+}
+
+// an edge kept without test : frozen by a warm start, or required
+bool ContinuousPC::isFrozen(const gum::Edge &edge) const
+{
+  return frozen_.contains(edge) || required_.contains(edge);
+}
+
+// an edge removed by the tests of size 0 in the high-dimension mode
+bool ContinuousPC::isPairRemoved(const gum::Edge &edge) const
+{
+  return !pairRemoved_.empty() && pairRemoved_[PairIndex(edge)];
+}
+
+/**
+ * Tests of size 0 in the high-dimension mode : the pairs are tested without
+ * building the complete graph, the results are kept in flat arrays instead
+ * of the edge properties and the log-pdf of each pair is released as soon
+ * as it has been used (the next levels use another k).
+ *
+ * @return the graph of the pairs not removed
+ */
+gum::UndiGraph ContinuousPC::testEmptyConditioningSet()
+{
+  const OT::UnsignedInteger dimension = tester_.getDimension();
+  const OT::UnsignedInteger pairs = dimension * (dimension - 1) / 2;
+  pairPValues_.assign(pairs, 0.0);
+  pairTTests_.assign(pairs, 0.0);
+  pairRemoved_.assign(pairs, false);
+
+  // the pairs with a negligible rank correlation are removed untested
+  std::unique_ptr<RankCorrelationScreening> screening;
+  if (rankScreening_)
+  {
+    screening.reset(new RankCorrelationScreening(data_));
+    screening->computeSkeleton();
+  }
+
+  const OT::Indices empty;
+  gum::UndiGraph g;
+  for (gum::NodeId i = 0; i < dimension; ++i)
+    g.addNodeWithId(i);
+  for (gum::NodeId i = 0; i < dimension; ++i)
+  {
+    // the pairs not tested yet are kept
+    const bool interrupted = control_.report("skeleton", 0, dimension - i,
+                             testsNumber_);
+    for (gum::NodeId j = 0; j < i; ++j)
+    {
+      const gum::Edge edge(i, j);
+      if (forbidden_.contains(edge))
+        continue;
+      if (interrupted || required_.contains(edge))
+      {
+        g.addEdge(i, j);
+        continue;
+      }
+      const auto index = PairIndex(edge);
+      if (screening && screening->isRemoved(i, j))
+      {
+        const double p = screening->getPValue(i, j);
+        pairPValues_[index] = p;
+        pairTTests_[index] = -OT::DistFunc::qNormal(0.5 * p);
+        pairRemoved_[index] = true;
+        continue;
+      }
+      const auto y = edge.first();
+      const auto z = edge.second();
+      double t = 0.0, p = 0.0;
+      bool ok = false;
+      std::tie(t, p, ok) = isIndep(y, z, empty);
+      tester_.releaseLogPDFs(y, z, empty);
+
+      pairPValues_[index] = p;
+      pairTTests_[index] = t;
+      if (ok)
+      {
+        TRACE(TRACE_EDGE(y, z) << " CUT |" << empty << ", pvalue=" << p
+              << std::endl);
+        pairRemoved_[index] = true;
+      }
+      else
+      {
+        TRACE(TRACE_EDGE(y, z) << "     |" << empty << ", pvalue=" << p << "\n");
+        g.addEdge(i, j);
+        pvalues_.set(edge, p);
+        ttests_.set(edge, t);
+      }
+    }
+  }
+  return g;
+}
+
+// the nodes among which the separators of y and z are searched
+gum::NodeSet ContinuousPC::getCandidates(const gum::UndiGraph &g,
+                                         gum::NodeId y, gum::NodeId z) const
+{
+  auto nei = g.neighbours(y) * g.neighbours(z);
+  if (tiers_.getSize() == 0)
+    return nei;
+  const auto maxTier = std::max(tiers_[y], tiers_[z]);
+  gum::NodeSet res;
+  for (const auto x : nei)
+    if (tiers_[x] <= maxTier)
+      res.insert(x);
+  return res;
+}
+
+// remove the forbidden edges and restore the required ones in g
+void ContinuousPC::applyConstraints(gum::UndiGraph &g)
+{
+  for (const auto &edge : forbidden_)
+    g.eraseEdge(edge);
+  for (const auto &edge : required_)
+  {
+    if (g.existsEdge(edge))
+      continue;
+    g.addEdge(edge.first(), edge.second());
+    sepset_.erase(edge);
+    pvalues_.erase(edge);
+    ttests_.erase(edge);
+    removed_.erase(std::remove(removed_.begin(), removed_.end(), edge),
+                   removed_.end());
   }
-  return std::make_tuple(false, tmax, pmax, nullsep);
 }
 
-//
 /**
- * test all possible separator set of size n in graph g if a possible
- * separator set X is found for y,z then the edge is removed and the separator
- * is kept in sepset_
+ * Store the result of the search of a separator for edge : if found, the
+ * edge is removed from g and the separator is kept in sepset_.
  *
- * @param g : the graph
- * @param n : the size of searched separators (beginning with n=0)
- * @return true if at least one separator has been found (if an edge has been
- * cut)
+ * @return found
  */
-bool ContinuousPC::testCondSetWithSize(gum::UndiGraph &g,
-                                       OT::UnsignedInteger n)
+bool ContinuousPC::storeSearchResult(gum::UndiGraph &g, const gum::Edge &edge,
+                                     const bool found, const double t,
+                                     const double p, const OT::Indices &sep)
 {
-  if (g.sizeEdges() == 0)
-    return false;
-
-  bool atLeastOneInThisStep = false;
-  gum::EdgeProperty<gum::NodeSet> intersections;
-  for (const auto &edge : g.edges())
+  if (found) // we found at least one separator
   {
-    const auto y = edge.first();
-    const auto z = edge.second();
-    const auto nei = g.neighbours(y) * g.neighbours(z);
-    if (nei.size() >= n)
-      intersections.set(edge, nei);
+    sepset_.set(edge, sep);
+    pvalues_.set(edge, p);
+    ttests_.set(edge, t);
+    TRACE(TRACE_EDGE(edge.first(), edge.second())
+          << " CUT |" << sepset_[edge] << ", pvalue=" << pvalues_[edge]
+          << std::endl);
+    removed_.push_back(edge);
+    g.eraseEdge(edge);
   }
-
-  gum::EdgeSet edgeset = g.edges();
-  for (const auto &edge : edgeset)
+  else
   {
-    if (!intersections.exists(edge))
-    {
-      continue;
-    }
-    const auto &nei = intersections[edge];
-    const auto y = edge.first();
-    const auto z = edge.second();
-    bool resYZ = false;
-    double pYZ = 0.0, tYZ = 0.0;
-    OT::Indices sepYZ;
-
-    std::tie(resYZ, tYZ, pYZ, sepYZ) =
-      getSeparator(g, y, z, Utils::FromNodeSet(nei), n);
-
-    if (resYZ) // we found at least one separator
-    {
-      sepset_.set(edge, sepYZ);
-      pvalues_.set(edge, pYZ);
-      ttests_.set(edge, tYZ);
-      TRACE(TRACE_EDGE(edge.first(), edge.second())
-            << " CUT |" << sepset_[edge] << ", pvalue=" << pvalues_[edge]
-            << std::endl);
-      atLeastOneInThisStep = true;
-      removed_.push_back(edge);
-      g.eraseEdge(edge);
-    }
-    else
-    {
-      pvalues_.set(edge, std::max(pvalues_.getWithDefault(edge, 0), pYZ));
-      ttests_.set(edge, std::max(ttests_.getWithDefault(edge, -10000), tYZ));
-    }
+    pvalues_.set(edge, std::max(pvalues_.getWithDefault(edge, 0), p));
+    ttests_.set(edge, std::max(ttests_.getWithDefault(edge, -10000), t));
   }
-
-  return atLeastOneInThisStep;
+  return found;
 }
 
 // From complete graph g, remove as much as possible edge (y,z) in g
@@ -232,35 +1576,115 @@ bool ContinuousPC::testCondSetWithSize(gum::UndiGraph &g,
 gum::UndiGraph ContinuousPC::inferSkeleton()
 {
   gum::UndiGraph g;
-  tester_.clearCache();
+  // the cache of a warm start is still valid
+  if (!warmStart_)
+    tester_.clearCache();
   sepset_.clear();
   pvalues_.clear();
+  ttests_.clear();
+  levelTTests_.clear();
   removed_.clear();
+  capped_.clear();
+  pairPValues_.clear();
+  pairTTests_.clear();
+  pairRemoved_.clear();
+  testsNumber_ = 0;
+  control_.start();
+  // first size of conditioning sets tested by the loop
+  OT::UnsignedInteger firstLevel = startLevel_;
 
   TRACE("== PC algo starting " << std::endl);
-  // create the complete graph
-  for (gum::NodeId i = 0; i < tester_.getDimension(); ++i)
+  if (warmStart_)
   {
-    g.addNodeWithId(i);
-    for (gum::NodeId j = 0; j < i; ++j)
+    g = initialSkeleton_;
+    sepset_ = initialSepset_;
+    pvalues_ = initialPValues_;
+    ttests_ = initialTTests_;
+    removed_ = initialRemoved_;
+    capped_ = resumedCapped_;
+    TRACE("==  warm start : " << g.sizeEdges() - frozen_.size() << " of "
+          << g.sizeEdges() << " edges to test" << std::endl);
+  }
+  else if (highDimension_ && (maxCondSet_ > 0))
+  {
+    // the removed pairs are not stored in the checkpoints
+    if (!checkpointFile_.empty())
+      throw OT::InvalidArgumentException(HERE)
+          << "Error: no checkpoint in high-dimension mode";
+    TRACE("==  Size of conditioning set 0" << std::endl);
+    g = testEmptyConditioningSet();
+    firstLevel = 1;
+  }
+  else if (rankScreening_)
+  {
+    // only the pairs with a rank correlation are in the initial graph, the
+    // others are removed with an empty separator
+    RankCorrelationScreening screening(data_);
+    g = screening.computeSkeleton();
+    const OT::Indices empty;
+    for (gum::NodeId i = 0; i < tester_.getDimension(); ++i)
+      for (gum::NodeId j = 0; j < i; ++j)
+      {
+        const gum::Edge edge(i, j);
+        if (g.existsEdge(edge) || forbidden_.contains(edge))
+          continue;
+        const double p = screening.getPValue(i, j);
+        sepset_.set(edge, empty);
+        pvalues_.set(edge, p);
+        ttests_.set(edge, -OT::DistFunc::qNormal(0.5 * p));
+        removed_.push_back(edge);
+      }
+    TRACE("==  rank screening : " << g.sizeEdges() << " edges to test"
+          << std::endl);
+  }
+  else
+  {
+    // create the complete graph
+    for (gum::NodeId i = 0; i < tester_.getDimension(); ++i)
     {
-      g.addEdge(i, j);
+      g.addNodeWithId(i);
+      for (gum::NodeId j = 0; j < i; ++j)
+      {
+        g.addEdge(i, j);
+      }
     }
   }
 
+  // the forbidden edges are not tested at all
+  if (startLevel_ == 0)
+    applyConstraints(g);
+
+  // log-pdfs of the next level computed while the current one finishes
+  std::future<PrefetchedLogPDFs> prefetch;
+
   // for each size of sepset from 0 to n-1
-  for (OT::UnsignedInteger n = 0; n < maxCondSet_; ++n)
+  for (OT::UnsignedInteger n = firstLevel; n < maxCondSet_; ++n)
   {
     TRACE("==  Size of conditioning set " << n << std::endl);
     // clear the pdfs not used anymore (due to the dimension of data)
     if (n > 0)
       tester_.clearCacheLevel(n - 1);
-
-    testCondSetWithSize(g, n);
+    collectPrefetch(prefetch);
+    if (!checkpointFile_.empty())
+      writeCheckpoint(g, n);
+    if (control_.report("skeleton", n, g.sizeEdges(), testsNumber_))
+      break;
+
+    testCondSetWithSize(g, n,
+                        (prefetch_ && (n + 1 < maxCondSet_)) ? &prefetch : nullptr);
     // perform all the tests for size n
     // if (!testCondSetWithSize(g, n))
     // break;
+    if (control_.isInterrupted())
+      break;
+  }
+  // the last checkpoint written allows one to resume an interrupted run
+  if (control_.isInterrupted())
+  {
+    TRACE("== interrupted after " << testsNumber_ << " tests" << std::endl);
   }
+  else if (!checkpointFile_.empty())
+    writeCheckpoint(g, std::max(startLevel_, maxCondSet_));
   TRACE("== end" << std::endl);
 
   return g;
@@ -286,7 +1710,7 @@ NamedJunctionTree ContinuousPC::learnJunctionTree()
 
   jt_ = NamedJunctionTree(deriveJunctionTree(deriveMoralGraph(pdag_)),
                           namesFromData());
-  jt_done_ = true;
+  jt_done_ = pdag_done_;
   return jt_;
 }
 
@@ -302,7 +1726,7 @@ NamedDAG ContinuousPC::learnDAG()
   gum::DAG dag = meekRules.propagateToDAG(pdag_);
   dag_ = NamedDAG(dag, namesFromData());
 
-  dag_done_ = true;
+  dag_done_ = pdag_done_;
   return dag_;
 }
 
@@ -314,17 +1738,177 @@ gum::MixedGraph ContinuousPC::learnPDAG()
     learnSkeleton();
 
   pdag_ = inferPDAG(skel_);
-  pdag_done_ = true;
+  pdag_done_ = skel_done_;
   return pdag_;
 }
 
+void ContinuousPC::setAlpha(const double alpha)
+{
+  if (alpha == tester_.getAlpha())
+    return;
+  tester_.setAlpha(alpha);
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+  if (warmStart_)
+    reclassifyWarmStart();
+}
+
+// the decisions carried over by a warm start are revised for the new alpha :
+// the removed edges now dependent are reopened, and the frozen edges near them
+// or now independent are tested again
+void ContinuousPC::reclassifyWarmStart()
+{
+  const double alpha = tester_.getAlpha();
+  gum::NodeSet touched;
+  std::vector<gum::Edge> kept;
+  for (const auto &edge : initialRemoved_)
+  {
+    if (initialPValues_[edge] < alpha)
+    {
+      initialSkeleton_.addEdge(edge.first(), edge.second());
+      initialSepset_.erase(edge);
+      initialPValues_.erase(edge);
+      initialTTests_.erase(edge);
+      touched.insert(edge.first());
+      touched.insert(edge.second());
+    }
+    else
+      kept.push_back(edge);
+  }
+  initialRemoved_ = kept;
+  for (const auto &edge : frozen_)
+  {
+    if (initialPValues_.getWithDefault(edge, 0.0) >= alpha)
+    {
+      touched.insert(edge.first());
+      touched.insert(edge.second());
+    }
+  }
+  gum::EdgeSet unfrozen;
+  for (const auto &edge : frozen_)
+    if (touched.contains(edge.first()) || touched.contains(edge.second()))
+      unfrozen.insert(edge);
+  for (const auto &edge : unfrozen)
+  {
+    frozen_.erase(edge);
+    initialPValues_.erase(edge);
+    initialTTests_.erase(edge);
+  }
+  // the reopened edges have to go through all the levels
+  if (!touched.empty())
+    startLevel_ = 0;
+}
+
+double ContinuousPC::getAlpha() const
+{
+  return tester_.getAlpha();
+}
+
+// test of y,z given sep, with the memoized t-statistic if any
+std::tuple<double, double, bool>
+ContinuousPC::isIndep(gum::NodeId y, gum::NodeId z,
+                      const OT::Indices &sep) const
+{
+  ++testsNumber_;
+  if (!memoize_)
+    return tester_.isIndep(y, z, sep);
+
+  const auto key = std::to_string(y) + "," + std::to_string(z) + "|" +
+                   sep.__str__();
+  if (!memo_.exists(key))
+    memo_.insert(key, tester_.getTTest(y, z, sep));
+  return ContinuousTTest::isIndepFromTest(memo_[key], tester_.getAlpha());
+}
+
+void ContinuousPC::startSweep(const OT::Point &alphas)
+{
+  for (OT::UnsignedInteger i = 1; i < alphas.getSize(); ++i)
+    if (alphas[i] < alphas[i - 1])
+      throw OT::InvalidArgumentException(HERE)
+          << "Error: the alphas must be sorted in increasing order, got "
+          << alphas;
+  memo_.clear();
+  memoize_ = true;
+}
+
+// restore the state of the object before the sweep
+void ContinuousPC::endSweep(const double alpha)
+{
+  memoize_ = false;
+  memo_.clear();
+  tester_.setAlpha(alpha);
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+ContinuousPC::Sweep::Sweep(ContinuousPC &learner, const OT::Point &alphas)
+  : learner_(learner), alpha_(learner.getAlpha())
+{
+  learner_.startSweep(alphas);
+}
+
+ContinuousPC::Sweep::~Sweep()
+{
+  learner_.endSweep(alpha_);
+}
+
+/**
+ * Learn the skeleton for each alpha of the sorted list alphas.
+ *
+ * The t-statistics do not depend on alpha : each test is computed once
+ * during the sweep and only its comparison to alpha is done for each run,
+ * hence the runs share all the tests met on their common search paths. The
+ * results are the same as independent runs (except with a time budget per
+ * edge, see setMaximumTimePerEdge).
+ */
+std::vector<gum::UndiGraph> ContinuousPC::learnSkeletons(const OT::Point &alphas)
+{
+  const Sweep sweep(*this, alphas);
+  std::vector<gum::UndiGraph> res;
+  for (const auto a : alphas)
+  {
+    setAlpha(a);
+    res.push_back(learnSkeleton());
+  }
+  return res;
+}
+
+std::vector<gum::MixedGraph> ContinuousPC::learnPDAGs(const OT::Point &alphas)
+{
+  const Sweep sweep(*this, alphas);
+  std::vector<gum::MixedGraph> res;
+  for (const auto a : alphas)
+  {
+    setAlpha(a);
+    res.push_back(learnPDAG());
+  }
+  return res;
+}
+
+std::vector<NamedDAG> ContinuousPC::learnDAGs(const OT::Point &alphas)
+{
+  const Sweep sweep(*this, alphas);
+  std::vector<NamedDAG> res;
+  for (const auto a : alphas)
+  {
+    setAlpha(a);
+    res.push_back(learnDAG());
+  }
+  return res;
+}
+
 gum::UndiGraph ContinuousPC::learnSkeleton()
 {
   if (skel_done_)
     return skel_;
 
   skel_ = inferSkeleton();
-  skel_done_ = true;
+  // an interrupted learning is not kept : the next call learns again
+  skel_done_ = !control_.isInterrupted();
   return skel_;
 }
 // for all triplet x-y-z (no edge between x and z), if y is not in sepset[x,z]
@@ -361,6 +1945,10 @@ gum::MixedGraph ContinuousPC::inferPDAG(const gum::UndiGraph &g) const
               queue.insert(Triplet{x, y, z}, pvalues_[xz]);
             }
           }
+          else if (isPairRemoved(xz)) // separated by the empty set
+          {
+            queue.insert(Triplet{x, y, z}, pairPValues_[PairIndex(xz)]);
+          }
         }
       }
     }
@@ -368,34 +1956,33 @@ gum::MixedGraph ContinuousPC::inferPDAG(const gum::UndiGraph &g) const
 
   for (auto e : g.edges())
   {
-    pdag.addEdge(e.first(), e.second());
+    // the edges between two tiers are oriented by the background knowledge
+    if ((tiers_.getSize() != 0) && (tiers_[e.first()] != tiers_[e.second()]))
+    {
+      if (tiers_[e.first()] < tiers_[e.second()])
+        pdag.addArc(e.first(), e.second());
+      else
+        pdag.addArc(e.second(), e.first());
+    }
+    else
+      pdag.addEdge(e.first(), e.second());
   }
+  // the directed paths are kept up to date instead of searched for each triplet
+  IncrementalReachability reachability(pdag);
   while (!queue.empty())
   {
     Triplet t = queue.pop();
     if (!(pdag.existsArc(t.y, t.x) || pdag.existsArc(t.y, t.z)))
     {
       // we can add the v-structure
-      try
-      {
-        pdag.directedPath(t.y, t.x);
-        continue;
-      }
-      catch (const gum::NotFound &)
-      {
-      }
-      try
-      {
-        pdag.directedPath(t.y, t.z);
+      if (reachability.existsPath(t.y, t.x) || reachability.existsPath(t.y, t.z))
         continue;
-      }
-      catch (const gum::NotFound &)
-      {
-      }
       pdag.eraseEdge(gum::Edge(t.x, t.y));
       pdag.eraseEdge(gum::Edge(t.z, t.y));
       pdag.addArc(t.x, t.y);
       pdag.addArc(t.z, t.y);
+      reachability.addArc(t.x, t.y);
+      reachability.addArc(t.z, t.y);
     }
   }
 
@@ -739,6 +2326,10 @@ double ContinuousPC::getPValue(gum::NodeId x, gum::NodeId y) const
   {
     return pvalues_[e];
   }
+  else if (isPairRemoved(e))
+  {
+    return pairPValues_[PairIndex(e)];
+  }
   else
   {
     throw OT::InvalidArgumentException(HERE)
@@ -754,6 +2345,10 @@ double ContinuousPC::getTTest(gum::NodeId x, gum::NodeId y) const
   {
     return ttests_[e];
   }
+  else if (isPairRemoved(e))
+  {
+    return pairTTests_[PairIndex(e)];
+  }
   else
   {
     throw OT::InvalidArgumentException(HERE)
@@ -769,6 +2364,10 @@ OT::Indices ContinuousPC::getSepset(gum::NodeId x, gum::NodeId y) const
   {
     return sepset_[e];
   }
+  else if (isPairRemoved(e))
+  {
+    return OT::Indices();
+  }
   else
   {
     throw OT::InvalidArgumentException(HERE)
@@ -787,6 +2386,181 @@ bool ContinuousPC::getVerbosity() const
   return verbose_;
 };
 
+void ContinuousPC::setMonitor(LearningMonitor *monitor)
+{
+  control_.setMonitor(monitor);
+}
+
+void ContinuousPC::setMaximumWallTime(const double maximumWallTime)
+{
+  control_.setMaximumWallTime(maximumWallTime);
+}
+
+double ContinuousPC::getMaximumWallTime() const
+{
+  return control_.getMaximumWallTime();
+}
+
+bool ContinuousPC::isInterrupted() const
+{
+  return control_.isInterrupted();
+}
+
+OT::UnsignedInteger ContinuousPC::getTestsNumber() const
+{
+  return testsNumber_;
+}
+
+void ContinuousPC::setSeparatorOrdering(SeparatorOrderingTypes ordering)
+{
+  ordering_ = ordering;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+ContinuousPC::SeparatorOrderingTypes ContinuousPC::getSeparatorOrdering() const
+{
+  return ordering_;
+}
+
+void ContinuousPC::setGroupedScheduling(const bool grouped)
+{
+  if (grouped && prefetch_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the grouped scheduling does not prefetch";
+  if (grouped && (workersNumber_ > 0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the worker processes do not group the tests";
+  grouped_ = grouped;
+}
+
+bool ContinuousPC::getGroupedScheduling() const
+{
+  return grouped_;
+}
+
+// the prefetch is only done by the edge by edge tests of the current process
+void ContinuousPC::setPrefetch(const bool prefetch)
+{
+  if (prefetch && grouped_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the grouped scheduling does not prefetch";
+  if (prefetch && (workersNumber_ > 0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the worker processes do not prefetch";
+  prefetch_ = prefetch;
+}
+
+bool ContinuousPC::getPrefetch() const
+{
+  return prefetch_;
+}
+
+void ContinuousPC::setWorkersNumber(const OT::UnsignedInteger workersNumber)
+{
+  if ((workersNumber > 0) && !ProcessPool::IsAvailable())
+    throw OT::NotYetImplementedException(HERE)
+        << "Error: worker processes are only available on Linux";
+  if ((workersNumber > 0) && grouped_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the worker processes do not group the tests";
+  if ((workersNumber > 0) && !ProcessPool::IsForkSafe())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: worker processes need a single TBB thread, see TBB.SetThreadsNumber";
+  if ((workersNumber > 0) && prefetch_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the worker processes do not prefetch";
+  workersNumber_ = workersNumber;
+}
+
+OT::UnsignedInteger ContinuousPC::getWorkersNumber() const
+{
+  return workersNumber_;
+}
+
+void ContinuousPC::setMaximumTestsPerEdge(const OT::UnsignedInteger maximumTests)
+{
+  maxTestsPerEdge_ = maximumTests;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+  capped_.clear();
+}
+
+OT::UnsignedInteger ContinuousPC::getMaximumTestsPerEdge() const
+{
+  return maxTestsPerEdge_;
+}
+
+void ContinuousPC::setMaximumTimePerEdge(const double maximumTime)
+{
+  if (maximumTime < 0.0)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the maximum time per edge must be non-negative, here "
+        << maximumTime << ".";
+  maxTimePerEdge_ = maximumTime;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+  capped_.clear();
+}
+
+double ContinuousPC::getMaximumTimePerEdge() const
+{
+  return maxTimePerEdge_;
+}
+
+void ContinuousPC::setSeed(const OT::UnsignedInteger seed)
+{
+  seed_ = seed;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+  capped_.clear();
+}
+
+OT::UnsignedInteger ContinuousPC::getSeed() const
+{
+  return seed_;
+}
+
+void ContinuousPC::setHighDimension(const bool highDimension)
+{
+  highDimension_ = highDimension;
+  // the pairs of the previous learning are not kept in the other bookkeeping
+  pairPValues_.clear();
+  pairTTests_.clear();
+  pairRemoved_.clear();
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+bool ContinuousPC::getHighDimension() const
+{
+  return highDimension_;
+}
+
+void ContinuousPC::setRankScreening(const bool rankScreening)
+{
+  rankScreening_ = rankScreening;
+  skel_done_ = false;
+  pdag_done_ = false;
+  dag_done_ = false;
+  jt_done_ = false;
+}
+
+bool ContinuousPC::getRankScreening() const
+{
+  return rankScreening_;
+}
+
 const std::vector<gum::Edge> &ContinuousPC::getRemoved() const
 {
   return removed_;
@@ -794,8 +2568,9 @@ const std::vector<gum::Edge> &ContinuousPC::getRemoved() const
 
 bool ContinuousPC::isRemoved(gum::NodeId x, gum::NodeId y) const
 {
-  return (std::find(removed_.begin(), removed_.end(), gum::Edge(x, y)) !=
-          removed_.end());
+  // the removed edges are the ones with a separator
+  const gum::Edge e(x, y);
+  return sepset_.exists(e) || isPairRemoved(e);
 }
 
 bool ContinuousPC::isRemoved(const std::string &x, const std::string &y) const
@@ -803,6 +2578,16 @@ bool ContinuousPC::isRemoved(const std::string &x, const std::string &y) const
   return isRemoved(idFromName(x), idFromName(y));
 }
 
+bool ContinuousPC::isCapped(gum::NodeId x, gum::NodeId y) const
+{
+  return capped_.contains(gum::Edge(x, y));
+}
+
+bool ContinuousPC::isCapped(const std::string &x, const std::string &y) const
+{
+  return isCapped(idFromName(x), idFromName(y));
+}
+
 double ContinuousPC::getPValue(const std::string &x,
                                const std::string &y) const
 {
@@ -831,19 +2616,15 @@ ContinuousPC::getSepsetNames(const std::string &x, const std::string &y) const
 
 gum::NodeId ContinuousPC::idFromName(const std::string &n) const
 {
-  const auto &description = tester_.getDataDescription();
-  for (OT::UnsignedInteger i = 0; i < description.getSize(); i++)
-  {
-    if (n == description.at(i))
-    {
-      return gum::NodeId(i);
-    }
-  }
+  if (nameIds_.exists(n))
+    return nameIds_[n];
 
   throw OT::InvalidArgumentException(HERE)
       << "Error: name '" << n << "' is not a node name.";
 }
 
+// the pairs removed by the tests of size 0 in the high-dimension mode are not
+// listed
 std::vector<std::string> ContinuousPC::getTrace() const
 {
   const auto &description = tester_.getDataDescription();
@@ -868,8 +2649,37 @@ std::vector<std::string> ContinuousPC::getTrace() const
     ss << std::setw(10) << edg << "|" << std::left << std::setw(20) << cond;
     ss << "  p=" << std::left << std::setw(10) << pvalues_[removed_[i]];
     ss << "  ttest=" << ttests_[removed_[i]];
+    if (capped_.contains(removed_[i]))
+      ss << "  (capped)";
     res[i] = ss.str();
   }
+  // the edges kept although their search has been capped by the budget
+  for (const auto &edge : capped_)
+  {
+    if (isRemoved(edge.first(), edge.second()))
+      continue;
+    std::stringstream ss;
+    const auto edg = description[edge.first()] + "-" +
+                     description[edge.second()];
+    ss << "kept: " << std::setw(10) << edg << "|" << std::left
+       << std::setw(20) << "" << "  (capped)";
+    res.push_back(ss.str());
+  }
   return res;
 }
+
+struct ContinuousPC_init
+{
+  ContinuousPC_init()
+  {
+    // fraction of the edges of a level tested before prefetching the next one
+    OT::ResourceMap::AddAsScalar("ContinuousPC-PrefetchThreshold", 0.75);
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousPC-MaximumPrefetchSize", 200);
+    // number of edges sent at once to a worker process
+    OT::ResourceMap::AddAsUnsignedInteger("ContinuousPC-WorkersBatchSize", 8);
+  }
+};
+
+static ContinuousPC_init __ContinuousPC_initializer;
+
 } // namespace OTAGRUM
@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <tuple>
+#include <vector>
 
 #include <agrum/base/core/timer.h>
 #include <openturns/DistFunc.hxx>
@@ -28,6 +29,7 @@
 #include <openturns/Log.hxx>
 #include <openturns/NormalCopulaFactory.hxx>
 #include <openturns/SpecFunc.hxx>
+#include <openturns/TBBImplementation.hxx>
 
 #include "otagrum/ContinuousTTest.hxx"
 
@@ -61,8 +63,8 @@ std::string ContinuousTTest::GetKey(const OT::Indices &l,
   return l.__str__() + ":" + std::to_string(k);
 }
 
-OT::Point ContinuousTTest::getLogPDF(const OT::Indices &l,
-                                     const OT::UnsignedInteger k) const
+OT::Point ContinuousTTest::computeLogPDF(const OT::Indices &l,
+    const OT::UnsignedInteger k) const
 {
   if (l.getSize() == 0)
   {
@@ -72,10 +74,6 @@ OT::Point ContinuousTTest::getLogPDF(const OT::Indices &l,
   if (l.getSize() == 1)
     return OT::Point(1, 0.0);
 
-  const auto key = GetKey(l, k);
-  if (cache_.exists(key))
-    return cache_.get(key);
-
   auto dL = data_.getMarginal(l);
 
   // OT::BernsteinCopulaFactory factory;
@@ -88,11 +86,81 @@ OT::Point ContinuousTTest::getLogPDF(const OT::Indices &l,
   auto logPDF =
     OT::EmpiricalBernsteinCopula(dL, k, true).computeLogPDF(dL).asPoint();
   LOGINFO(OT::OSS() << "End of compute log-PDF for k=" << k << ", l=" << l);
+  return logPDF;
+}
+
+OT::Point ContinuousTTest::getLogPDF(const OT::Indices &l,
+                                     const OT::UnsignedInteger k) const
+{
+  if (l.getSize() <= 1)
+    return computeLogPDF(l, k);
 
+  const auto key = GetKey(l, k);
+  if (cache_.exists(key))
+    return cache_.get(key);
+
+  auto logPDF = computeLogPDF(l, k);
   cache_.set(l.getSize(), key, logPDF);
   return logPDF;
 }
 
+namespace
+{
+struct ComputeLogPDFsPolicy
+{
+  const ContinuousTTest &tester_;
+  const std::vector<OT::Indices> &sets_;
+  const OT::UnsignedInteger k_;
+  std::vector<OT::Point> &output_;
+
+  ComputeLogPDFsPolicy(const ContinuousTTest &tester,
+                       const std::vector<OT::Indices> &sets,
+                       const OT::UnsignedInteger k,
+                       std::vector<OT::Point> &output)
+    : tester_(tester), sets_(sets), k_(k), output_(output)
+  {
+  }
+
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger i = r.begin(); i != r.end(); ++i)
+      output_[i] = tester_.computeLogPDF(sets_[i], k_);
+  }
+};
+} // namespace
+
+std::vector<OT::Point>
+ContinuousTTest::computeLogPDFs(const std::vector<OT::Indices> &sets,
+                                const OT::UnsignedInteger k) const
+{
+  std::vector<OT::Point> logPDFs(sets.size());
+  const ComputeLogPDFsPolicy policy(*this, sets, k, logPDFs);
+  OT::TBBImplementation::ParallelFor(0, sets.size(), policy);
+  return logPDFs;
+}
+
+void ContinuousTTest::storeLogPDFs(const std::vector<OT::Indices> &sets,
+                                   const OT::UnsignedInteger k,
+                                   const std::vector<OT::Point> &logPDFs) const
+{
+  for (OT::UnsignedInteger i = 0; i < sets.size(); ++i)
+    if (sets[i].getSize() > 1)
+      cache_.set(sets[i].getSize(), GetKey(sets[i], k), logPDFs[i]);
+}
+
+bool ContinuousTTest::isCached(const OT::Indices &l,
+                               const OT::UnsignedInteger k) const
+{
+  return (l.getSize() <= 1) || cache_.exists(GetKey(l, k));
+}
+
+OT::UnsignedInteger
+ContinuousTTest::getK(const OT::UnsignedInteger conditioningSize) const
+{
+  return GetK(data_.getSize(), conditioningSize + 2);
+}
+
 std::tuple<OT::Point, OT::Point, OT::Point, OT::Point, OT::UnsignedInteger>
 ContinuousTTest::getLogPDFs(const OT::UnsignedInteger Y,
                             const OT::UnsignedInteger Z,
@@ -361,6 +429,25 @@ void ContinuousTTest::clearCacheLevel(const OT::UnsignedInteger level) const
   cache_.clearLevel(level);
 }
 
+void ContinuousTTest::writeCache(std::ostream &os) const
+{
+  cache_.write(os);
+}
+
+void ContinuousTTest::readCache(std::istream &is) const
+{
+  cache_.read(is);
+}
+
+void ContinuousTTest::releaseLogPDFs(const OT::UnsignedInteger Y,
+                                     const OT::UnsignedInteger Z,
+                                     const OT::Indices &X) const
+{
+  const OT::UnsignedInteger k = GetK(data_.getSize(), X.getSize() + 2);
+  for (const auto &l : {X, X + Y, X + Z, X + Y + Z})
+    cache_.erase(l.getSize(), GetKey(l, k));
+}
+
 OT::UnsignedInteger ContinuousTTest::getDimension() const
 {
   return data_.getDimension();
@@ -1,9 +1,16 @@
+#include <algorithm>
 #include <cmath>
+#include <iostream>
+#include <unordered_map>
 
+#include <openturns/DistFunc.hxx>
 #include <openturns/EmpiricalBernsteinCopula.hxx>
 #include <openturns/NormalCopulaFactory.hxx>
+#include <openturns/RandomGenerator.hxx>
+#include <openturns/ResourceMap.hxx>
 
 #include "otagrum/CorrectedMutualInformation.hxx"
+#include "otagrum/EntropyStore.hxx"
 
 namespace OTAGRUM
 {
@@ -12,6 +19,25 @@ CorrectedMutualInformation::CorrectedMutualInformation(const OT::Sample &data)
   : OT::Object()
 {
   data_ = (data.rank() + 1) / (data.getSize() + 2); // Switching data to rank space
+  setUseEntropyStore(OT::ResourceMap::GetAsBool("CorrectedMutualInformation-UseEntropyStore"));
+  millerMadowCorrection_ = OT::ResourceMap::GetAsBool("CorrectedMutualInformation-MillerMadowCorrection");
+  setEntropyTolerance(OT::ResourceMap::GetAsScalar("CorrectedMutualInformation-EntropyTolerance"));
+}
+
+CorrectedMutualInformation::CorrectedMutualInformation(const CorrectedMutualInformation *shared)
+  : OT::Object()
+  , data_(shared->data_)
+  , kmode_(shared->kmode_)
+  , cmode_(shared->cmode_)
+  , alpha_(shared->alpha_)
+  , millerMadowCorrection_(shared->millerMadowCorrection_)
+  , entropyTolerance_(shared->entropyTolerance_)
+  , evaluationOrder_(shared->evaluationOrder_)
+  , shared_(shared)
+  , useEntropyStore_(shared->useEntropyStore_)
+  , fingerprint_(shared->fingerprint_)
+  , normalScores_(shared->normalScores_)
+{
 }
 
 void CorrectedMutualInformation::setKMode(KModeTypes kmode)
@@ -24,18 +50,64 @@ void CorrectedMutualInformation::setCMode(CModeTypes cmode)
 {
   clearCaches();
   cmode_ = cmode;
+  if (cmode_ == CModeTypes::Gaussian)
+    computeNormalScores();
 }
 
-CorrectedMutualInformation::KModeTypes CorrectedMutualInformation::getKMode()
+CorrectedMutualInformation::KModeTypes CorrectedMutualInformation::getKMode() const
 {
   return kmode_;
 }
 
-CorrectedMutualInformation::CModeTypes CorrectedMutualInformation::getCMode()
+CorrectedMutualInformation::CModeTypes CorrectedMutualInformation::getCMode() const
 {
   return cmode_;
 }
 
+void CorrectedMutualInformation::setMillerMadowCorrection(const bool millerMadowCorrection)
+{
+  clearCaches();
+  millerMadowCorrection_ = millerMadowCorrection;
+}
+
+bool CorrectedMutualInformation::getMillerMadowCorrection() const
+{
+  return millerMadowCorrection_;
+}
+
+void CorrectedMutualInformation::setEntropyTolerance(const double entropyTolerance)
+{
+  if (!(entropyTolerance >= 0.0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the entropy tolerance must be nonnegative, here entropyTolerance=" << entropyTolerance;
+  clearCaches();
+  entropyTolerance_ = entropyTolerance;
+  const OT::UnsignedInteger size = data_.getSize();
+  if ((entropyTolerance_ > 0.0) && (evaluationOrder_.getSize() != size))
+  {
+    // Fisher-Yates shuffle driven by the OpenTURNS generator
+    evaluationOrder_ = OT::Indices(size);
+    evaluationOrder_.fill();
+    const OT::Point u(OT::RandomGenerator::Generate(size));
+    for (OT::UnsignedInteger i = 0; i + 1 < size; ++i)
+    {
+      const OT::UnsignedInteger j = std::min(size - 1,
+                                             i + static_cast<OT::UnsignedInteger>(u[i] * (size - i)));
+      std::swap(evaluationOrder_[i], evaluationOrder_[j]);
+    }
+  }
+}
+
+double CorrectedMutualInformation::getEntropyTolerance() const
+{
+  return entropyTolerance_;
+}
+
+double CorrectedMutualInformation::getInformationStandardError() const
+{
+  return std::sqrt(informationVariance_);
+}
+
 void CorrectedMutualInformation::setAlpha(const double alpha)
 {
   alpha_ = alpha;
@@ -66,9 +138,93 @@ void CorrectedMutualInformation::clearCaches() const
   clearHCache();
 }
 
+// with the EntropyStore, the cache is made of its entries on the same data
+// and copula model, written with the keys of HCache_
+void CorrectedMutualInformation::writeCaches(std::ostream &os) const
+{
+  const auto precision = os.precision(17);
+  if (useEntropyStore_)
+  {
+    const std::string prefix(getStorePrefix());
+    std::vector<std::pair<std::string, double> > entries;
+    for (const auto &entry : EntropyStore::GetEntries(prefix))
+    {
+      const std::string key(entry.first.substr(prefix.size()));
+      // the standard errors are not kept, as with HCache_
+      if ((key.size() < 3) || (key.compare(key.size() - 3, 3, ":SE") != 0))
+        entries.push_back(std::make_pair(key, entry.second));
+    }
+    os << entries.size() << std::endl;
+    for (const auto &entry : entries)
+      os << entry.first << ' ' << entry.second << std::endl;
+  }
+  else
+  {
+    os << HCache_.size() << std::endl;
+    for (auto iter = HCache_.cbegin(); iter != HCache_.cend(); ++iter)
+      os << iter.key() << ' ' << iter.val() << std::endl;
+  }
+  os.precision(precision);
+}
+
+void CorrectedMutualInformation::readCaches(std::istream &is) const
+{
+  OT::UnsignedInteger count = 0;
+  is >> count;
+  for (OT::UnsignedInteger i = 0; i < count; ++i)
+  {
+    std::string key;
+    double value = 0.0;
+    is >> key >> value;
+    if (!is)
+      throw OT::InvalidArgumentException(HERE)
+          << "Error: cannot read the cache entry " << i;
+    if (useEntropyStore_)
+      EntropyStore::Set(getStorePrefix() + key, value);
+    else
+      HCache_.set(key, value);
+  }
+}
+
+CorrectedMutualInformation CorrectedMutualInformation::getLocalCopy() const
+{
+  return CorrectedMutualInformation(this);
+}
+
+void CorrectedMutualInformation::mergeCaches(const CorrectedMutualInformation &local) const
+{
+  for (auto iter = local.HCache_.cbegin(); iter != local.HCache_.cend(); ++iter)
+    HCache_.set(iter.key(), iter.val());
+  for (auto iter = local.pairMoments_.cbegin(); iter != local.pairMoments_.cend(); ++iter)
+    pairMoments_.set(iter.key(), iter.val());
+  for (auto iter = local.SECache_.cbegin(); iter != local.SECache_.cend(); ++iter)
+    SECache_.set(iter.key(), iter.val());
+}
+
+void CorrectedMutualInformation::setUseEntropyStore(const bool useEntropyStore)
+{
+  useEntropyStore_ = useEntropyStore;
+  if (useEntropyStore_ && fingerprint_.empty())
+    fingerprint_ = EntropyStore::GetFingerprint(data_);
+}
+
+bool CorrectedMutualInformation::getUseEntropyStore() const
+{
+  return useEntropyStore_;
+}
+
+// the entries of the store are shared by the instances on the same data and
+// with the same copula model
+std::string CorrectedMutualInformation::getStorePrefix() const
+{
+  return fingerprint_ + ":" + std::to_string(static_cast<int>(cmode_)) + ":";
+}
+
 void CorrectedMutualInformation::clearHCache() const
 {
   HCache_.clear();
+  pairMoments_.clear();
+  SECache_.clear();
 }
 
 // Get key associated to an OT::Indices in order to store it in cache
@@ -109,12 +265,36 @@ double CorrectedMutualInformation::computeCrossEntropy(const OT::Indices &variab
       case CModeTypes::Bernstein:
         key = GetKey(variables, K);
         break;
+      case CModeTypes::Histogram:
+        key = GetKey(variables, K) + (millerMadowCorrection_ ? ":MM" : "");
+        break;
         //default:
     }
+    // the subsampled entropies depend on the tolerance
+    if ((entropyTolerance_ > 0.0) && (cmode_ != CModeTypes::Histogram))
+      key += ":" + std::to_string(entropyTolerance_);
+    // the entries of the store are shared by the instances on the same data
+    std::string storeKey;
+    if (useEntropyStore_)
+      storeKey = getStorePrefix() + key;
+    if ((shared_ != nullptr) && shared_->HCache_.exists(key))
+    {
+      addEntropyVariance(key, storeKey);
+      return shared_->HCache_[key];
+    }
+    if (useEntropyStore_)
+    {
+      double H = 0.;
+      if (EntropyStore::Get(storeKey, H))
+      {
+        addEntropyVariance(key, storeKey);
+        return H;
+      }
+    }
     if (!HCache_.exists(key))    // if H(variables) haven't been computed
     {
-      auto marginal_data = data_.getMarginal(variables);
       double H = 0.;
+      double standardError = 0.;
       // Is there a way to declare only one copula ?
       // Plus it would cleaner to have no mention of K in the Gaussian case
       auto nc = OT::NormalCopula();
@@ -122,24 +302,50 @@ double CorrectedMutualInformation::computeCrossEntropy(const OT::Indices &variab
       switch (cmode_)
       {
         case CModeTypes::Gaussian:
+        {
+          // closed form, unless the correlation is not positive definite
+          if (computeGaussianEntropy(variables, H))
+            break;
+          const OT::Sample marginal_data(data_.getMarginal(variables));
           nc = OT::NormalCopulaFactory().buildAsNormalCopula(marginal_data);
-          H = -nc.computeLogPDF(marginal_data).computeMean()[0];
+          H = -computeMeanLogPDF(nc, marginal_data, standardError);
           break;
+        }
 
         case CModeTypes::Bernstein:
+        {
+          const OT::Sample marginal_data(data_.getMarginal(variables));
           bc = OT::EmpiricalBernsteinCopula(marginal_data, K, false);
-          H = -bc.computeLogPDF(marginal_data).computeMean()[0];
+          H = -computeMeanLogPDF(bc, marginal_data, standardError);
+          break;
+        }
+
+        case CModeTypes::Histogram:
+          H = computeHistogramEntropy(variables, K);
           break;
 
           //default:
           // GUM_ERROR ?
 
       }
-      HCache_.insert(key, H);
+      if (useEntropyStore_)
+      {
+        EntropyStore::Set(storeKey, H);
+        if (standardError > 0.)
+          EntropyStore::Set(storeKey + ":SE", standardError);
+      }
+      else
+      {
+        HCache_.insert(key, H);
+        if (standardError > 0.)
+          SECache_.insert(key, standardError);
+      }
+      informationVariance_ += standardError * standardError;
       return H;
     }
     else
     {
+      addEntropyVariance(key, storeKey);
       return HCache_[key];
     }
   }
@@ -149,6 +355,295 @@ double CorrectedMutualInformation::computeCrossEntropy(const OT::Indices &variab
   }
 }
 
+// Mean of the log-density of copula over sample. With a tolerance, the points
+// are taken in the order of evaluationOrder_, by subsets of doubling size,
+// until the standard error of the mean, with the finite population
+// correction, is below entropyTolerance_ * alpha_.
+double CorrectedMutualInformation::computeMeanLogPDF(const OT::Distribution &copula,
+    const OT::Sample &sample,
+    double &standardError) const
+{
+  standardError = 0.0;
+  const OT::UnsignedInteger size = sample.getSize();
+  if ((entropyTolerance_ <= 0.0) || (evaluationOrder_.getSize() != size))
+    return copula.computeLogPDF(sample).computeMean()[0];
+  const double threshold = entropyTolerance_ * alpha_;
+  double sum = 0.0;
+  double sumSquares = 0.0;
+  OT::UnsignedInteger evaluated = 0;
+  OT::UnsignedInteger target = std::min(size, std::max<OT::UnsignedInteger>(2,
+                                        OT::ResourceMap::GetAsUnsignedInteger("CorrectedMutualInformation-EntropySubsampleSize")));
+  while (true)
+  {
+    OT::Indices points(target - evaluated);
+    for (OT::UnsignedInteger i = 0; i < points.getSize(); ++i)
+      points[i] = evaluationOrder_[evaluated + i];
+    const OT::Sample logPDF(copula.computeLogPDF(sample.select(points)));
+    for (OT::UnsignedInteger i = 0; i < logPDF.getSize(); ++i)
+    {
+      const double value = logPDF(i, 0);
+      sum += value;
+      sumSquares += value * value;
+    }
+    evaluated = target;
+    if (evaluated == size)
+    {
+      standardError = 0.0;
+      break;
+    }
+    const double mean = sum / evaluated;
+    const double variance = std::max(0.0, (sumSquares - evaluated * mean * mean) / (evaluated - 1.0));
+    standardError = std::sqrt(variance / evaluated * (1.0 - static_cast<double>(evaluated) / size));
+    if (standardError <= threshold)
+      break;
+    target = std::min(size, 2 * target);
+  }
+  return sum / evaluated;
+}
+
+// adds the variance of the cached entropy of key to the information
+void CorrectedMutualInformation::addEntropyVariance(const std::string &key,
+    const std::string &storeKey)
+{
+  if (entropyTolerance_ <= 0.0)
+    return;
+  double standardError = 0.0;
+  if (SECache_.exists(key))
+    standardError = SECache_[key];
+  else if ((shared_ != nullptr) && shared_->SECache_.exists(key))
+    standardError = shared_->SECache_[key];
+  else if (useEntropyStore_)
+    EntropyStore::Get(storeKey + ":SE", standardError);
+  informationVariance_ += standardError * standardError;
+}
+
+/* In the Gaussian mode the entropy of the normal copula fitted on the
+ * variables S is -mean(log c(u)) = 0.5 * log det R_S + 0.5 * tr((R_S^-1 - I) M_S)
+ * where R_S is its correlation and M_S the empirical second moment of the
+ * normal scores z = Phi^-1(u). The estimator of R_S works pair by pair, so
+ * both matrices are built from per-pair values computed once, and the data
+ * are no more read afterwards. */
+void CorrectedMutualInformation::computeNormalScores()
+{
+  if (normalScores_.getSize() == data_.getSize())
+    return;
+  // read through a const reference, data_ being shared with the local copies
+  const OT::Sample &data = data_;
+  const OT::UnsignedInteger size = data.getSize();
+  const OT::UnsignedInteger dimension = data.getDimension();
+  OT::Sample scores(size, dimension);
+  for (OT::UnsignedInteger i = 0; i < size; ++i)
+    for (OT::UnsignedInteger j = 0; j < dimension; ++j)
+      scores(i, j) = OT::DistFunc::qNormal(data(i, j));
+  normalScores_ = scores;
+}
+
+// correlation and second moment of the normal scores of the pair (i, j)
+std::pair<double, double> CorrectedMutualInformation::getPairMoments(
+  const OT::UnsignedInteger i,
+  const OT::UnsignedInteger j)
+{
+  const std::pair< gum::Size, gum::Size > key(std::min(i, j), std::max(i, j));
+  if (pairMoments_.exists(key))
+    return pairMoments_[key];
+  if ((shared_ != nullptr) && shared_->pairMoments_.exists(key))
+    return shared_->pairMoments_[key];
+
+  computeNormalScores();
+  const OT::Sample &scores = normalScores_;
+  const OT::UnsignedInteger size = scores.getSize();
+  double moment = 0.0;
+  for (OT::UnsignedInteger n = 0; n < size; ++n)
+    moment += scores(n, i) * scores(n, j);
+  moment /= size;
+  double correlation = 1.0;
+  if (i != j)
+  {
+    OT::Indices pair(2);
+    pair[0] = key.first;
+    pair[1] = key.second;
+    correlation = OT::NormalCopulaFactory().buildAsNormalCopula(data_.getMarginal(pair)).getShapeMatrix()(1, 0);
+  }
+  const std::pair<double, double> moments(correlation, moment);
+  pairMoments_.insert(key, moments);
+  return moments;
+}
+
+// adds a variable to the factor by bordering it: false if the correlation is
+// not positive definite
+bool CorrectedMutualInformation::extendGaussianFactor(GaussianFactor &factor,
+    const OT::UnsignedInteger variable)
+{
+  const OT::UnsignedInteger n = factor.variables.getSize();
+  std::vector<double> row(n + 1, 0.0);
+  double norm = 0.0;
+  OT::UnsignedInteger offset = 0;
+  for (OT::UnsignedInteger k = 0; k < n; ++k)
+  {
+    double value = getPairMoments(factor.variables[k], variable).first;
+    for (OT::UnsignedInteger m = 0; m < k; ++m)
+      value -= factor.lower[offset + m] * row[m];
+    row[k] = value / factor.lower[offset + k];
+    norm += row[k] * row[k];
+    offset += k + 1;
+  }
+  const double pivot = 1.0 - norm;
+  if (!(pivot > 0.0))
+    return false;
+  row[n] = std::sqrt(pivot);
+  factor.lower.insert(factor.lower.end(), row.begin(), row.end());
+  factor.logDet += std::log(pivot);
+  factor.variables.add(variable);
+  return true;
+}
+
+// the factor of the conditioning set, extended to U+X, U+Y and U+X+Y
+void CorrectedMutualInformation::setGaussianPrefix(const OT::Indices &U)
+{
+  if ((cmode_ != CModeTypes::Gaussian) || (prefix_.variables == U))
+    return;
+  prefix_ = GaussianFactor();
+  extensions_.clear();
+  GaussianFactor factor;
+  for (const auto variable : U)
+    if (!extendGaussianFactor(factor, variable))
+      return;
+  prefix_ = factor;
+}
+
+// the factors of U extended by X, by Y and by X then Y, so that the
+// entropies of the 3-point informations only add Z
+void CorrectedMutualInformation::setGaussianPrefixes(const OT::Indices &U,
+    const OT::UnsignedInteger X,
+    const OT::UnsignedInteger Y)
+{
+  setGaussianPrefix(U);
+  if ((cmode_ != CModeTypes::Gaussian) || !(prefix_.variables == U))
+    return;
+  if ((extensions_.size() == 3) && (extensions_[2].variables == U + X + Y)
+      && (extensions_[1].variables == U + Y))
+    return;
+  extensions_.clear();
+  GaussianFactor factorX(prefix_);
+  GaussianFactor factorY(prefix_);
+  if (!extendGaussianFactor(factorX, X) || !extendGaussianFactor(factorY, Y))
+    return;
+  GaussianFactor factorXY(factorX);
+  if (!extendGaussianFactor(factorXY, Y))
+    return;
+  extensions_.push_back(factorX);
+  extensions_.push_back(factorY);
+  extensions_.push_back(factorXY);
+}
+
+bool CorrectedMutualInformation::computeGaussianEntropy(const OT::Indices &variables,
+    double &H)
+{
+  const OT::UnsignedInteger dimension = variables.getSize();
+  // start from the longest known factor of the first variables
+  const GaussianFactor *base = nullptr;
+  OT::UnsignedInteger start = 0;
+  std::vector<const GaussianFactor *> candidates(1, &prefix_);
+  for (const auto &extension : extensions_)
+    candidates.push_back(&extension);
+  for (const GaussianFactor *candidate : candidates)
+  {
+    const OT::UnsignedInteger length = candidate->variables.getSize();
+    if ((length > dimension) || ((base != nullptr) && (length <= start)))
+      continue;
+    bool isPrefix = true;
+    for (OT::UnsignedInteger k = 0; isPrefix && (k < length); ++k)
+      isPrefix = (candidate->variables[k] == variables[k]);
+    if (isPrefix)
+    {
+      base = candidate;
+      start = length;
+    }
+  }
+  GaussianFactor factor;
+  if (base != nullptr)
+    factor = *base;
+  for (OT::UnsignedInteger k = start; k < dimension; ++k)
+    if (!extendGaussianFactor(factor, variables[k]))
+      return false;
+
+  // W = L^-1 row by row, then tr(R^-1 M) = sum_m w_m^T M w_m
+  std::vector<double> M(dimension * dimension);
+  double traceM = 0.0;
+  for (OT::UnsignedInteger i = 0; i < dimension; ++i)
+  {
+    for (OT::UnsignedInteger j = 0; j <= i; ++j)
+    {
+      const double moment = getPairMoments(variables[i], variables[j]).second;
+      M[i * dimension + j] = moment;
+      M[j * dimension + i] = moment;
+    }
+    traceM += M[i * dimension + i];
+  }
+  std::vector<double> W(dimension * dimension, 0.0);
+  OT::UnsignedInteger offset = 0;
+  for (OT::UnsignedInteger i = 0; i < dimension; ++i)
+  {
+    const double diagonal = factor.lower[offset + i];
+    W[i * dimension + i] = 1.0 / diagonal;
+    for (OT::UnsignedInteger j = 0; j < i; ++j)
+    {
+      double value = 0.0;
+      for (OT::UnsignedInteger k = j; k < i; ++k)
+        value += factor.lower[offset + k] * W[k * dimension + j];
+      W[i * dimension + j] = -value / diagonal;
+    }
+    offset += i + 1;
+  }
+  double trace = 0.0;
+  for (OT::UnsignedInteger m = 0; m < dimension; ++m)
+    for (OT::UnsignedInteger i = 0; i <= m; ++i)
+      for (OT::UnsignedInteger j = 0; j <= m; ++j)
+        trace += W[m * dimension + i] * M[i * dimension + j] * W[m * dimension + j];
+  H = 0.5 * factor.logDet + 0.5 * (trace - traceM);
+  return true;
+}
+
+// The copula density is estimated by a histogram with K^d cells of volume
+// K^-d, so H = H_cells - d log(K) with H_cells the entropy of the cell
+// frequencies. The occupied cells are numbered one variable at a time: the
+// cell of the first j variables has an index lower than N, so the index and
+// the next bin fit in one integer and a single hash table pass per variable
+// is needed, whatever K^d.
+double CorrectedMutualInformation::computeHistogramEntropy(const OT::Indices &variables,
+    const OT::UnsignedInteger K) const
+{
+  const OT::Sample &data = data_;
+  const OT::UnsignedInteger size = data.getSize();
+  const OT::UnsignedInteger dimension = variables.getSize();
+  std::vector<OT::UnsignedInteger> cell(size, 0);
+  std::unordered_map<OT::UnsignedInteger, OT::UnsignedInteger> cells;
+  cells.reserve(size);
+  for (OT::UnsignedInteger j = 0; j < dimension; ++j)
+  {
+    cells.clear();
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
+    {
+      const OT::UnsignedInteger bin = std::min(K - 1,
+                                      static_cast<OT::UnsignedInteger>(data(i, variables[j]) * K));
+      const auto inserted = cells.emplace(cell[i] * K + bin, cells.size());
+      cell[i] = inserted.first->second;
+    }
+  }
+  std::vector<OT::UnsignedInteger> counts(cells.size(), 0);
+  for (OT::UnsignedInteger i = 0; i < size; ++i)
+    ++counts[cell[i]];
+  double H = 0.0;
+  for (const OT::UnsignedInteger count : counts)
+  {
+    const double p = static_cast<double>(count) / size;
+    H -= p * std::log(p);
+  }
+  if (millerMadowCorrection_)
+    H += (counts.size() - 1.0) / (2.0 * size);
+  return H - dimension * std::log(static_cast<double>(K));
+}
+
 OT::UnsignedInteger CorrectedMutualInformation::GetK(const OT::UnsignedInteger size,
     const OT::UnsignedInteger dimension)
 {
@@ -160,6 +655,8 @@ double CorrectedMutualInformation::compute2PtInformation(const OT::UnsignedInteg
     const OT::Indices &U)
 {
   OT::UnsignedInteger K = GetK(data_.getSize(), U.getSize() + 2);
+  setGaussianPrefix(U);
+  informationVariance_ = 0.0;
 
   double H_XU = computeCrossEntropy(U + X, K);
   double H_YU = computeCrossEntropy(U + Y, K);
@@ -178,6 +675,7 @@ double CorrectedMutualInformation::compute2PtInformation(const OT::Indices &X,
     const OT::Indices &Y)
 {
   OT::UnsignedInteger K = GetK(data_.getSize(), X.getSize() + Y.getSize());
+  informationVariance_ = 0.0;
 
   double H_X = computeCrossEntropy(X, K);
   double H_Y = computeCrossEntropy(Y, K);
@@ -237,6 +735,8 @@ double CorrectedMutualInformation::compute3PtInformation(const OT::UnsignedInteg
     const OT::Indices &U)
 {
   OT::UnsignedInteger K = GetK(data_.getSize(), U.getSize() + 3);
+  setGaussianPrefixes(U, X, Y);
+  informationVariance_ = 0.0;
 
   double H_XU = computeCrossEntropy(U + X, K);
   double H_YU = computeCrossEntropy(U + Y, K);
@@ -291,4 +791,64 @@ double CorrectedMutualInformation::compute3PtCorrectedInformation(const OT::Unsi
   return compute3PtInformation(X, Y, Z, U) - compute3PtPenalty();
 }
 
+OT::Point CorrectedMutualInformation::compute3PtCorrectedInformations(const OT::UnsignedInteger X,
+    const OT::UnsignedInteger Y,
+    const OT::Indices &Zs,
+    const OT::Indices &U)
+{
+  const OT::UnsignedInteger K = GetK(data_.getSize(), U.getSize() + 3);
+  setGaussianPrefixes(U, X, Y);
+  informationVariance_ = 0.0;
+
+  // same terms and summation order as compute3PtInformation
+  const double H_XU = computeCrossEntropy(U + X, K);
+  const double H_YU = computeCrossEntropy(U + Y, K);
+  const double H_XYU = computeCrossEntropy(U + X + Y, K);
+  const double H_U = computeCrossEntropy(U, K);
+  const double sharedVariance = informationVariance_;
+  const OT::Indices UX(U + X);
+  const OT::Indices UY(U + Y);
+  const OT::Indices UXY(U + X + Y);
+
+  OT::Point informations(Zs.getSize());
+  OT::UnsignedInteger best = 0;
+  for (OT::UnsignedInteger i = 0; i < Zs.getSize(); ++i)
+  {
+    const OT::UnsignedInteger Z = Zs[i];
+    informationVariance_ = sharedVariance;
+    const double H_ZU = computeCrossEntropy(U + Z, K);
+    const double H_XZU = computeCrossEntropy(UX + Z, K);
+    const double H_YZU = computeCrossEntropy(UY + Z, K);
+    const double H_XYZU = computeCrossEntropy(UXY + Z, K);
+    const double IXYZ_U = H_XU + H_YU + H_ZU - H_XYU - H_XZU - H_YZU + H_XYZU - H_U;
+    informations[i] = IXYZ_U - compute3PtPenalty();
+    if (informations[i] > informations[best])
+      best = i;
+  }
+  best3PtContributor_ = (Zs.getSize() > 0) ? Zs[best] : 0;
+  return informations;
+}
+
+OT::UnsignedInteger CorrectedMutualInformation::getBest3PtContributor() const
+{
+  return best3PtContributor_;
+}
+
+struct CorrectedMutualInformation_init
+{
+  CorrectedMutualInformation_init()
+  {
+    // whether the new instances use the EntropyStore instead of a private cache
+    OT::ResourceMap::AddAsBool("CorrectedMutualInformation-UseEntropyStore", false);
+    // whether the histogram entropies include the Miller-Madow correction
+    OT::ResourceMap::AddAsBool("CorrectedMutualInformation-MillerMadowCorrection", true);
+    // relative tolerance of the subsampled entropies (0 for exact ones)
+    OT::ResourceMap::AddAsScalar("CorrectedMutualInformation-EntropyTolerance", 0.0);
+    // size of the first subset of points of the subsampled entropies
+    OT::ResourceMap::AddAsUnsignedInteger("CorrectedMutualInformation-EntropySubsampleSize", 100);
+  }
+};
+
+static CorrectedMutualInformation_init __CorrectedMutualInformation_initializer;
+
 } // namespace OTAGRUM
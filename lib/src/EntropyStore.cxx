@@ -0,0 +1,175 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief EntropyStore shares the entropies between the learners
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include <openturns/ResourceMap.hxx>
+
+#include "otagrum/EntropyStore.hxx"
+
+namespace OTAGRUM
+{
+
+namespace
+{
+// the entries from the most to the least recently used, indexed by key
+struct Store
+{
+  std::mutex mutex;
+  std::list<std::pair<std::string, double>> entries;
+  std::unordered_map<std::string, std::list<std::pair<std::string, double>>::iterator> index;
+  OT::UnsignedInteger maximumSize = OT::ResourceMap::GetAsUnsignedInteger("EntropyStore-MaximumSize");
+
+  void shrink()
+  {
+    while (entries.size() > maximumSize)
+    {
+      index.erase(entries.back().first);
+      entries.pop_back();
+    }
+  }
+};
+
+Store &GetStore()
+{
+  static Store store;
+  return store;
+}
+} // namespace
+
+bool EntropyStore::Get(const std::string &key, double &value)
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  const auto iter = store.index.find(key);
+  if (iter == store.index.end())
+    return false;
+  store.entries.splice(store.entries.begin(), store.entries, iter->second);
+  value = iter->second->second;
+  return true;
+}
+
+void EntropyStore::Set(const std::string &key, const double value)
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  const auto iter = store.index.find(key);
+  if (iter != store.index.end())
+  {
+    iter->second->second = value;
+    store.entries.splice(store.entries.begin(), store.entries, iter->second);
+    return;
+  }
+  store.entries.emplace_front(key, value);
+  store.index[key] = store.entries.begin();
+  store.shrink();
+}
+
+std::vector<std::pair<std::string, double> >
+EntropyStore::GetEntries(const std::string &prefix)
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  std::vector<std::pair<std::string, double> > entries;
+  for (const auto &entry : store.entries)
+    if (entry.first.compare(0, prefix.size(), prefix) == 0)
+      entries.push_back(entry);
+  return entries;
+}
+
+void EntropyStore::Clear()
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  store.entries.clear();
+  store.index.clear();
+}
+
+OT::UnsignedInteger EntropyStore::GetSize()
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  return store.entries.size();
+}
+
+void EntropyStore::SetMaximumSize(const OT::UnsignedInteger maximumSize)
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  store.maximumSize = maximumSize;
+  store.shrink();
+}
+
+OT::UnsignedInteger EntropyStore::GetMaximumSize()
+{
+  Store &store = GetStore();
+  std::lock_guard<std::mutex> lock(store.mutex);
+  return store.maximumSize;
+}
+
+// FNV-1a on the bytes of the values
+std::string EntropyStore::GetFingerprint(const OT::Sample &sample)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  const auto mix = [&hash](const std::uint64_t word)
+  {
+    for (OT::UnsignedInteger k = 0; k < 8; ++k)
+    {
+      hash ^= (word >> (8 * k)) & 0xff;
+      hash *= 1099511628211ULL;
+    }
+  };
+  const OT::UnsignedInteger size = sample.getSize();
+  const OT::UnsignedInteger dimension = sample.getDimension();
+  mix(size);
+  mix(dimension);
+  for (OT::UnsignedInteger i = 0; i < size; ++i)
+    for (OT::UnsignedInteger j = 0; j < dimension; ++j)
+    {
+      const double value = sample(i, j);
+      std::uint64_t word = 0;
+      std::memcpy(&word, &value, sizeof(word));
+      mix(word);
+    }
+  std::ostringstream oss;
+  oss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return oss.str();
+}
+
+struct EntropyStore_init
+{
+  EntropyStore_init()
+  {
+    // maximum number of entropies kept by the store
+    OT::ResourceMap::AddAsUnsignedInteger("EntropyStore-MaximumSize", 1000000);
+  }
+};
+
+static EntropyStore_init __EntropyStore_initializer;
+
+} // namespace OTAGRUM
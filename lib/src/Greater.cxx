@@ -1,54 +1,34 @@
+#include <algorithm>
+#include <cmath>
+
 #include "otagrum/Greater.hxx"
 
 namespace OTAGRUM
 {
 
-bool GreaterPairOn2nd::operator()(
-  const std::pair <
-  std::tuple< OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::Indices >*,
-  double > & e1,
-  const std::pair <
-  std::tuple< OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::Indices >*,
-  double > & e2) const
+bool GreaterContributor::operator()(const ContributorRecord &e1,
+                                    const ContributorRecord &e2) const
 {
-  return e1.second > e2.second;
+  return e1.score > e2.score;
 }
 
-bool GreaterTupleOnLast::operator()(
-  const std::tuple< std::tuple< OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::UnsignedInteger >*,
-  double, double, double >& e1,
-  const std::tuple< std::tuple< OT::UnsignedInteger,
-  OT::UnsignedInteger,
-  OT::UnsignedInteger >*,
-  double, double, double >& e2) const
+bool GreaterTriple::operator()(const TripleRecord &e1,
+                               const TripleRecord &e2) const
 {
-  double p1XZ = std::get< 2 >(e1);
-  double p1YZ = std::get< 3 >(e1);
-  double p2XZ = std::get< 2 >(e2);
-  double p2YZ = std::get< 3 >(e2);
-  double I1 = std::get< 1 >(e1);
-  double I2 = std::get< 1 >(e2);
+  const double I1 = e1.I;
+  const double I2 = e2.I;
   // First, we look at the sign of information.
-  // Then, the probility values
-  // and finally the abs value of information.
+  // Then, the probility values, the abs value of information
+  // and finally the order of discovery.
   if ( (I1 < 0 && I2 < 0) || (I1 >= 0 && I2 >= 0) )
   {
-    if (std::max(p1XZ, p1YZ) == std::max(p2XZ, p2YZ))
-    {
+    const double P1 = std::max(e1.PXZ, e1.PYZ);
+    const double P2 = std::max(e2.PXZ, e2.PYZ);
+    if (P1 != P2)
+      return P1 > P2;
+    if (std::abs(I1) != std::abs(I2))
       return std::abs(I1) > std::abs(I2);
-    }
-    else
-    {
-      return std::max(p1XZ, p1YZ) > std::max(p2XZ, p2YZ);
-    }
+    return e1.index < e2.index;
   }
   else
   {
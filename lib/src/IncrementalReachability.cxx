@@ -0,0 +1,149 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief IncrementalReachability keeps the directed paths of a graph
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+
+#include "otagrum/IncrementalReachability.hxx"
+
+namespace OTAGRUM
+{
+
+IncrementalReachability::IncrementalReachability()
+  : words_(0), dirty_(false)
+{
+}
+
+IncrementalReachability::IncrementalReachability(const gum::MixedGraph &graph)
+  : words_(0), dirty_(true)
+{
+  gum::NodeId size = 0;
+  for (const auto node : graph.nodes())
+    size = std::max(size, node + 1);
+  words_ = (size + 63) / 64;
+  children_.resize(size);
+  parents_.resize(size);
+  for (const auto &arc : graph.arcs())
+  {
+    children_[arc.tail()].insert(arc.head());
+    parents_[arc.head()].insert(arc.tail());
+  }
+}
+
+// an arc whose opposite is not in the graph
+bool IncrementalReachability::isPathArc(const gum::NodeId tail,
+                                        const gum::NodeId head) const
+{
+  return children_[tail].contains(head) && !children_[head].contains(tail);
+}
+
+bool IncrementalReachability::reaches(const gum::NodeId x,
+                                      const gum::NodeId y) const
+{
+  return (reach_[x][y / 64] >> (y % 64)) & 1;
+}
+
+// every node reaching tail (and tail) now reaches head and its descendants
+void IncrementalReachability::addPathArc(const gum::NodeId tail,
+    const gum::NodeId head)
+{
+  const auto descendants = reach_[head];
+  for (gum::NodeId x = 0; x < reach_.size(); ++x)
+  {
+    if ((x != tail) && !reaches(x, tail))
+      continue;
+    auto &row = reach_[x];
+    for (OT::UnsignedInteger w = 0; w < words_; ++w)
+      row[w] |= descendants[w];
+    row[head / 64] |= std::uint64_t(1) << (head % 64);
+  }
+}
+
+void IncrementalReachability::addArc(const gum::NodeId tail,
+                                     const gum::NodeId head)
+{
+  if (children_[tail].contains(head))
+    return;
+  children_[tail].insert(head);
+  parents_[head].insert(tail);
+  // the opposite arc is no more part of the paths
+  if (children_[head].contains(tail))
+    dirty_ = true;
+  if (!dirty_)
+    addPathArc(tail, head);
+}
+
+void IncrementalReachability::eraseArc(const gum::NodeId tail,
+                                       const gum::NodeId head)
+{
+  if (!children_[tail].contains(head))
+    return;
+  children_[tail].erase(head);
+  parents_[head].erase(tail);
+  dirty_ = true;
+}
+
+// depth-first search from each node
+void IncrementalReachability::update() const
+{
+  if (!dirty_)
+    return;
+  const gum::NodeId size = children_.size();
+  reach_.assign(size, std::vector<std::uint64_t>(words_, 0));
+  std::vector<gum::NodeId> stack;
+  for (gum::NodeId x = 0; x < size; ++x)
+  {
+    auto &row = reach_[x];
+    stack.assign(1, x);
+    while (!stack.empty())
+    {
+      const gum::NodeId current = stack.back();
+      stack.pop_back();
+      for (const auto child : children_[current])
+      {
+        if (!isPathArc(current, child) || reaches(x, child))
+          continue;
+        row[child / 64] |= std::uint64_t(1) << (child % 64);
+        stack.push_back(child);
+      }
+    }
+  }
+  dirty_ = false;
+}
+
+bool IncrementalReachability::existsPath(const gum::NodeId x,
+    const gum::NodeId y) const
+{
+  update();
+  return reaches(x, y);
+}
+
+// a path x ~> p -> y whose last arc does not come from x
+bool IncrementalReachability::existsPathAvoidingArc(const gum::NodeId x,
+    const gum::NodeId y) const
+{
+  update();
+  for (const auto p : parents_[y])
+    if ((p != x) && isPathArc(p, y) && reaches(x, p))
+      return true;
+  return false;
+}
+
+} // namespace OTAGRUM
@@ -0,0 +1,101 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief LearningMonitor follows the progress of a structure learning
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <openturns/Exception.hxx>
+
+#include "otagrum/LearningMonitor.hxx"
+
+namespace OTAGRUM
+{
+
+LearningMonitor::LearningMonitor()
+{
+}
+
+LearningMonitor::~LearningMonitor()
+{
+}
+
+// the default monitor never stops the learning
+bool LearningMonitor::update(const std::string & /*phase*/,
+                             const OT::UnsignedInteger /*level*/,
+                             const OT::UnsignedInteger /*remaining*/,
+                             const OT::UnsignedInteger /*testsNumber*/)
+{
+  return false;
+}
+
+LearningControl::LearningControl()
+  : monitor_(nullptr), maximumWallTime_(0.0), interrupted_(false)
+{
+}
+
+void LearningControl::setMonitor(LearningMonitor *monitor)
+{
+  monitor_ = monitor;
+}
+
+LearningMonitor *LearningControl::getMonitor() const
+{
+  return monitor_;
+}
+
+void LearningControl::setMaximumWallTime(const double maximumWallTime)
+{
+  if (!(maximumWallTime >= 0.0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the maximum wall time must be non-negative, here "
+        << maximumWallTime << ".";
+  maximumWallTime_ = maximumWallTime;
+}
+
+double LearningControl::getMaximumWallTime() const
+{
+  return maximumWallTime_;
+}
+
+void LearningControl::start()
+{
+  timer_.reset();
+  interrupted_ = false;
+}
+
+bool LearningControl::report(const std::string &phase,
+                             const OT::UnsignedInteger level,
+                             const OT::UnsignedInteger remaining,
+                             const OT::UnsignedInteger testsNumber)
+{
+  if (interrupted_)
+    return true;
+  if ((monitor_ != nullptr) &&
+      monitor_->update(phase, level, remaining, testsNumber))
+    interrupted_ = true;
+  else if ((maximumWallTime_ > 0.0) && (timer_.step() > maximumWallTime_))
+    interrupted_ = true;
+  return interrupted_;
+}
+
+bool LearningControl::isInterrupted() const
+{
+  return interrupted_;
+}
+
+} // namespace OTAGRUM
@@ -0,0 +1,275 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ProcessPool runs jobs in local worker processes
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cerrno>
+#include <cstdint>
+#include <iostream>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <openturns/Exception.hxx>
+#include <openturns/TBB.hxx>
+
+#include "otagrum/ProcessPool.hxx"
+
+namespace OTAGRUM
+{
+
+#ifdef __linux__
+namespace
+{
+// writes/reads exactly size bytes, false on error or end of stream
+bool WriteAll(const int fd, const char *buffer, std::size_t size)
+{
+  while (size > 0)
+  {
+    // no SIGPIPE if the other end has stopped
+    const ssize_t written = ::send(fd, buffer, size, MSG_NOSIGNAL);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    buffer += written;
+    size -= written;
+  }
+  return true;
+}
+
+bool ReadAll(const int fd, char *buffer, std::size_t size)
+{
+  while (size > 0)
+  {
+    const ssize_t received = ::recv(fd, buffer, size, 0);
+    if (received < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    if (received == 0)
+      return false;
+    buffer += received;
+    size -= received;
+  }
+  return true;
+}
+
+// a message is its size followed by its bytes
+bool WriteMessage(const int fd, const std::string &message)
+{
+  const std::uint64_t size = message.size();
+  return WriteAll(fd, reinterpret_cast<const char *>(&size), sizeof(size)) &&
+         WriteAll(fd, message.data(), message.size());
+}
+
+bool ReadMessage(const int fd, std::string &message)
+{
+  std::uint64_t size = 0;
+  if (!ReadAll(fd, reinterpret_cast<char *>(&size), sizeof(size)))
+    return false;
+  message.resize(size);
+  return ReadAll(fd, &message[0], size);
+}
+} // namespace
+#endif
+
+ProcessPool::ProcessPool(const OT::UnsignedInteger workersNumber,
+                         const Job &job)
+{
+#ifdef __linux__
+  if (workersNumber == 0)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the number of worker processes must be positive";
+  // a fork copies the locks held by the other threads in their locked state
+  if (!IsForkSafe())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: worker processes need a single TBB thread, see TBB.SetThreadsNumber";
+
+  // the buffered output would be written again by each worker
+  std::cout.flush();
+  std::cerr.flush();
+  for (OT::UnsignedInteger i = 0; i < workersNumber; ++i)
+  {
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+      stop();
+      throw OT::InternalException(HERE)
+          << "Error: cannot create a socket for a worker process";
+    }
+    const pid_t pid = ::fork();
+    if (pid < 0)
+    {
+      ::close(fds[0]);
+      ::close(fds[1]);
+      stop();
+      throw OT::InternalException(HERE)
+          << "Error: cannot create a worker process";
+    }
+    if (pid == 0)
+    {
+      // worker : the sockets of the coordinator are not used
+      ::close(fds[0]);
+      for (const auto &worker : workers_)
+        ::close(worker.fd);
+      int status = 0;
+      try
+      {
+        std::string request;
+        while (ReadMessage(fds[1], request))
+        {
+          const std::string response(job(request));
+          std::cout.flush();
+          if (!WriteMessage(fds[1], response))
+          {
+            status = 1;
+            break;
+          }
+        }
+      }
+      catch (...)
+      {
+        status = 1;
+      }
+      // no destructor nor atexit handler of the coordinator
+      ::_exit(status);
+    }
+    ::close(fds[1]);
+    workers_.push_back(Worker{pid, fds[0]});
+  }
+#else
+  (void)workersNumber;
+  (void)job;
+  throw OT::NotYetImplementedException(HERE)
+      << "Error: worker processes are only available on Linux";
+#endif
+}
+
+ProcessPool::~ProcessPool()
+{
+  stop();
+}
+
+// the workers stop at the end of their socket
+void ProcessPool::stop()
+{
+#ifdef __linux__
+  for (const auto &worker : workers_)
+    ::close(worker.fd);
+  for (const auto &worker : workers_)
+  {
+    int status = 0;
+    while ((::waitpid(worker.pid, &status, 0) < 0) && (errno == EINTR))
+    {
+    }
+  }
+#endif
+  workers_.clear();
+}
+
+std::vector<std::string>
+ProcessPool::run(const std::vector<std::string> &requests)
+{
+  std::vector<std::string> responses(requests.size());
+#ifdef __linux__
+  const OT::UnsignedInteger none = requests.size();
+  // the request processed by each worker, none if it is free
+  std::vector<OT::UnsignedInteger> current(workers_.size(), none);
+  OT::UnsignedInteger next = 0;
+  OT::UnsignedInteger done = 0;
+
+  auto dispatch = [&](const OT::UnsignedInteger i)
+  {
+    if (next == requests.size())
+      return;
+    if (!WriteMessage(workers_[i].fd, requests[next]))
+      throw OT::InternalException(HERE)
+          << "Error: the worker process " << workers_[i].pid
+          << " has stopped";
+    current[i] = next;
+    ++next;
+  };
+
+  for (OT::UnsignedInteger i = 0; i < workers_.size(); ++i)
+    dispatch(i);
+
+  std::vector<pollfd> fds(workers_.size());
+  while (done < requests.size())
+  {
+    for (OT::UnsignedInteger i = 0; i < workers_.size(); ++i)
+    {
+      // the negative descriptors are ignored by poll
+      fds[i].fd = (current[i] != none) ? workers_[i].fd : -1;
+      fds[i].events = POLLIN;
+      fds[i].revents = 0;
+    }
+    if (::poll(fds.data(), fds.size(), -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      throw OT::InternalException(HERE)
+          << "Error: cannot wait for the worker processes";
+    }
+    for (OT::UnsignedInteger i = 0; i < workers_.size(); ++i)
+    {
+      if (fds[i].revents == 0)
+        continue;
+      if (!ReadMessage(workers_[i].fd, responses[current[i]]))
+        throw OT::InternalException(HERE)
+            << "Error: the worker process " << workers_[i].pid
+            << " has stopped";
+      current[i] = none;
+      ++done;
+      dispatch(i);
+    }
+  }
+#endif
+  return responses;
+}
+
+OT::UnsignedInteger ProcessPool::getWorkersNumber() const
+{
+  return workers_.size();
+}
+
+bool ProcessPool::IsAvailable()
+{
+#ifdef __linux__
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool ProcessPool::IsForkSafe()
+{
+  return !OT::TBB::IsAvailable() || (OT::TBB::GetThreadsNumber() <= 1);
+}
+
+} // namespace OTAGRUM
@@ -0,0 +1,167 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief RankCorrelationScreening removes the negligible pairs of variables
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <openturns/DistFunc.hxx>
+#include <openturns/Matrix.hxx>
+#include <openturns/ResourceMap.hxx>
+
+#include "otagrum/RankCorrelationScreening.hxx"
+
+namespace OTAGRUM
+{
+
+RankCorrelationScreening::RankCorrelationScreening(const OT::Sample &data)
+  : OT::Object()
+  , data_(data)
+  , pValueThreshold_(0.0)
+{
+  if (data.getSize() < 3)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the screening needs at least 3 observations, here size=" << data.getSize();
+  setPValueThreshold(OT::ResourceMap::GetAsScalar("RankCorrelationScreening-PValueThreshold"));
+}
+
+void RankCorrelationScreening::setPValueThreshold(const double pValueThreshold)
+{
+  if (!(pValueThreshold >= 0.0) || !(pValueThreshold <= 1.0))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the p-value threshold must be in [0, 1], here pValueThreshold=" << pValueThreshold;
+  pValueThreshold_ = pValueThreshold;
+}
+
+double RankCorrelationScreening::getPValueThreshold() const
+{
+  return pValueThreshold_;
+}
+
+OT::UnsignedInteger RankCorrelationScreening::getPairIndex(const gum::NodeId x,
+    const gum::NodeId y) const
+{
+  const OT::UnsignedInteger dimension = data_.getDimension();
+  if ((x >= dimension) || (y >= dimension) || (x == y))
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: no pair " << x << "-" << y << " in dimension " << dimension;
+  const OT::UnsignedInteger first = std::min(x, y);
+  const OT::UnsignedInteger second = std::max(x, y);
+  return second * (second - 1) / 2 + first;
+}
+
+// the N x (stop - start) matrix of the scores of the variables start to stop
+static OT::Matrix GetBlock(const OT::Point &scores, const OT::UnsignedInteger size,
+                           const OT::UnsignedInteger start, const OT::UnsignedInteger stop)
+{
+  OT::Point values(size * (stop - start));
+  std::copy(scores.begin() + start * size, scores.begin() + stop * size, values.begin());
+  return OT::Matrix(size, stop - start, values);
+}
+
+/*
+ * The ranks of each variable are standardized, so that the Spearman
+ * correlation of a pair is the scalar product of its two columns divided by
+ * N - 1. The columns are grouped in blocks of RankCorrelationScreening-BlockSize
+ * variables and the correlations of two blocks are given by one matrix
+ * product, so that only one block of correlations is stored at a time.
+ * Under independence sqrt(N - 1) rho is asymptotically standard normal.
+ */
+gum::UndiGraph RankCorrelationScreening::computeSkeleton()
+{
+  const OT::UnsignedInteger size = data_.getSize();
+  const OT::UnsignedInteger dimension = data_.getDimension();
+  const OT::Sample ranks(data_.rank());
+
+  // standardized ranks, the N values of each variable being contiguous
+  OT::Point scores(size * dimension);
+  for (OT::UnsignedInteger j = 0; j < dimension; ++j)
+  {
+    double mean = 0.0;
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
+      mean += ranks(i, j);
+    mean /= size;
+    double variance = 0.0;
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
+      variance += (ranks(i, j) - mean) * (ranks(i, j) - mean);
+    variance /= (size - 1.0);
+    // a constant variable has no correlation
+    const double scale = (variance > 0.0) ? 1.0 / std::sqrt(variance) : 0.0;
+    for (OT::UnsignedInteger i = 0; i < size; ++i)
+      scores[j * size + i] = (ranks(i, j) - mean) * scale;
+  }
+
+  const OT::UnsignedInteger blockSize = std::max<OT::UnsignedInteger>(1,
+                                        OT::ResourceMap::GetAsUnsignedInteger("RankCorrelationScreening-BlockSize"));
+  const double scaling = std::sqrt(size - 1.0);
+  pValues_.assign(dimension * (dimension - 1) / 2, 1.0);
+  gum::UndiGraph skeleton;
+  for (gum::NodeId i = 0; i < dimension; ++i)
+    skeleton.addNodeWithId(i);
+
+  for (OT::UnsignedInteger start = 0; start < dimension; start += blockSize)
+  {
+    const OT::UnsignedInteger stop = std::min(dimension, start + blockSize);
+    const OT::Matrix left(GetBlock(scores, size, start, stop).transpose());
+    for (OT::UnsignedInteger otherStart = 0; otherStart <= start; otherStart += blockSize)
+    {
+      const OT::UnsignedInteger otherStop = std::min(dimension, otherStart + blockSize);
+      const OT::Matrix products(left * GetBlock(scores, size, otherStart, otherStop));
+      for (OT::UnsignedInteger i = start; i < stop; ++i)
+        for (OT::UnsignedInteger j = otherStart; j < std::min(otherStop, i); ++j)
+        {
+          const double rho = products(i - start, j - otherStart) / (size - 1.0);
+          const double pValue = std::min(1.0, 2.0 * OT::DistFunc::pNormal(-std::abs(rho) * scaling));
+          pValues_[getPairIndex(i, j)] = pValue;
+          if (pValue <= pValueThreshold_)
+            skeleton.addEdge(i, j);
+        }
+    }
+  }
+  return skeleton;
+}
+
+double RankCorrelationScreening::getPValue(const gum::NodeId x, const gum::NodeId y) const
+{
+  if (pValues_.empty())
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the screening has not been computed, call computeSkeleton first";
+  return pValues_[getPairIndex(x, y)];
+}
+
+bool RankCorrelationScreening::isRemoved(const gum::NodeId x, const gum::NodeId y) const
+{
+  return getPValue(x, y) > pValueThreshold_;
+}
+
+struct RankCorrelationScreening_init
+{
+  RankCorrelationScreening_init()
+  {
+    // pairs whose Spearman correlation has a larger p-value are removed
+    OT::ResourceMap::AddAsScalar("RankCorrelationScreening-PValueThreshold", 0.5);
+    // number of variables of the blocks multiplied together
+    OT::ResourceMap::AddAsUnsignedInteger("RankCorrelationScreening-BlockSize", 512);
+  }
+};
+
+static RankCorrelationScreening_init __RankCorrelationScreening_initializer;
+
+} // namespace OTAGRUM
@@ -20,12 +20,15 @@
  */
 
 #include <algorithm>
+#include <iostream>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <agrum/base/core/hashTable.h>
 
+#include <openturns/Exception.hxx>
+
 #include "otagrum/StratifiedCache.hxx"
 
 namespace OTAGRUM
@@ -64,6 +67,18 @@ void StratifiedCache::set(OT::UnsignedInteger level, const std::string &key,
   stratified_keys_[level].push_back(key);
 };
 
+void StratifiedCache::erase(OT::UnsignedInteger level, const std::string &key)
+{
+  if (!cache_.exists(key))
+    return;
+  cache_.erase(key);
+  if (level < stratified_keys_.size())
+  {
+    auto &keys = stratified_keys_[level];
+    keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+  }
+};
+
 void StratifiedCache::clearLevel(unsigned long level)
 {
   if (level < stratified_keys_.size())
@@ -98,6 +113,43 @@ int StratifiedCache::maxLevel() const
   return stratified_keys_.size() - 1;
 };
 
+void StratifiedCache::write(std::ostream &os) const
+{
+  const auto precision = os.precision(17);
+  os << size() << std::endl;
+  for (OT::UnsignedInteger level = 0; level < stratified_keys_.size(); ++level)
+  {
+    for (const auto &key : stratified_keys_[level])
+    {
+      const auto &values = cache_[key];
+      os << level << ' ' << key << ' ' << values.getSize();
+      for (const auto v : values)
+        os << ' ' << v;
+      os << std::endl;
+    }
+  }
+  os.precision(precision);
+}
+
+void StratifiedCache::read(std::istream &is)
+{
+  int count = 0;
+  is >> count;
+  for (int i = 0; i < count; ++i)
+  {
+    OT::UnsignedInteger level = 0, size = 0;
+    std::string key;
+    is >> level >> key >> size;
+    OT::Point values(size);
+    for (OT::UnsignedInteger j = 0; j < size; ++j)
+      is >> values[j];
+    if (!is)
+      throw OT::InvalidArgumentException(HERE)
+          << "Error: cannot read the cache entry " << i;
+    set(level, key, values);
+  }
+}
+
 std::string StratifiedCache::__str__(const std::string &offset) const
 {
   std::stringstream ss;
@@ -0,0 +1,272 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief StructureBootstrap
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+
+#include <openturns/TBBImplementation.hxx>
+
+#include "otagrum/ContinuousMIIC.hxx"
+#include "otagrum/ContinuousPC.hxx"
+#include "otagrum/StructureBootstrap.hxx"
+
+namespace OTAGRUM
+{
+
+static double DefaultAlpha(const StructureBootstrap::LearnerTypes learner)
+{
+  // the defaults of ContinuousPC and ContinuousMIIC
+  return learner == StructureBootstrap::LearnerTypes::PC ? 0.1 : 0.01;
+}
+
+/**
+ * create a bootstrap of structure learning
+ *
+ * @param data : the data
+ * @param bootstrapSize : the number of resamples
+ * @param learner : the structure learning algorithm
+ */
+StructureBootstrap::StructureBootstrap(const OT::Sample &data,
+                                       const OT::UnsignedInteger bootstrapSize,
+                                       const LearnerTypes learner)
+  : OT::Object(), data_(data), bootstrapSize_(bootstrapSize),
+    learner_(learner), maxCondSet_(5), alpha_(DefaultAlpha(learner)),
+    seed_(0), done_(false), edgeFrequencies_(data.getDimension()),
+    arcFrequencies_(data.getDimension())
+{
+  if (data.getSize() < 2)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the data must contain at least 2 rows";
+}
+
+void StructureBootstrap::setBootstrapSize(const OT::UnsignedInteger bootstrapSize)
+{
+  bootstrapSize_ = bootstrapSize;
+  done_ = false;
+}
+
+OT::UnsignedInteger StructureBootstrap::getBootstrapSize() const
+{
+  return bootstrapSize_;
+}
+
+void StructureBootstrap::setLearner(const LearnerTypes learner)
+{
+  learner_ = learner;
+  alpha_ = DefaultAlpha(learner);
+  done_ = false;
+}
+
+StructureBootstrap::LearnerTypes StructureBootstrap::getLearner() const
+{
+  return learner_;
+}
+
+void StructureBootstrap::setMaximumConditioningSetSize(
+  const OT::UnsignedInteger maxCondSet)
+{
+  maxCondSet_ = maxCondSet;
+  done_ = false;
+}
+
+OT::UnsignedInteger StructureBootstrap::getMaximumConditioningSetSize() const
+{
+  return maxCondSet_;
+}
+
+void StructureBootstrap::setAlpha(const double alpha)
+{
+  alpha_ = alpha;
+  done_ = false;
+}
+
+double StructureBootstrap::getAlpha() const
+{
+  return alpha_;
+}
+
+void StructureBootstrap::setSeed(const OT::UnsignedInteger seed)
+{
+  seed_ = seed;
+  done_ = false;
+}
+
+OT::UnsignedInteger StructureBootstrap::getSeed() const
+{
+  return seed_;
+}
+
+/**
+ * The rows of the replicate b are drawn with their own random stream, seeded
+ * from seed_ and b : the resamples do not depend on the number of threads nor
+ * on the order in which the replicates are learned.
+ */
+OT::Indices
+StructureBootstrap::getResampleIndices(const OT::UnsignedInteger b) const
+{
+  std::seed_seq seq{std::uint64_t(seed_), std::uint64_t(b)};
+  std::mt19937_64 generator(seq);
+  std::uniform_int_distribution<OT::UnsignedInteger> draw(0, data_.getSize() - 1);
+  OT::Indices indices(data_.getSize());
+  for (OT::UnsignedInteger i = 0; i < indices.getSize(); ++i)
+    indices[i] = draw(generator);
+  return indices;
+}
+
+/**
+ * The learners switch the resample to the rank space themselves : the ranks
+ * of the resample, with its repeated rows, are not a selection of the ranks
+ * of the data.
+ */
+void StructureBootstrap::learnReplicate(const OT::UnsignedInteger b,
+                                        gum::UndiGraph &skeleton,
+                                        gum::MixedGraph &pdag) const
+{
+  const OT::Sample resample(data_.select(getResampleIndices(b)));
+  if (learner_ == LearnerTypes::PC)
+  {
+    ContinuousPC learner(resample, maxCondSet_, alpha_);
+    skeleton = learner.learnSkeleton();
+    pdag = learner.learnPDAG();
+  }
+  else
+  {
+    ContinuousMIIC learner(resample);
+    learner.setAlpha(alpha_);
+    skeleton = learner.learnSkeleton();
+    pdag = learner.learnPDAG();
+  }
+}
+
+struct StructureBootstrapPolicy
+{
+  const StructureBootstrap &bootstrap_;
+  std::vector<gum::UndiGraph> &skeletons_;
+  std::vector<gum::MixedGraph> &pdags_;
+
+  StructureBootstrapPolicy(const StructureBootstrap &bootstrap,
+                           std::vector<gum::UndiGraph> &skeletons,
+                           std::vector<gum::MixedGraph> &pdags)
+    : bootstrap_(bootstrap), skeletons_(skeletons), pdags_(pdags)
+  {
+  }
+
+  inline void
+  operator()(const OT::TBBImplementation::BlockedRange<OT::UnsignedInteger> &r) const
+  {
+    for (OT::UnsignedInteger b = r.begin(); b != r.end(); ++b)
+      bootstrap_.learnReplicate(b, skeletons_[b], pdags_[b]);
+  }
+};
+
+/**
+ * learn the structures of the bootstrapSize resamples in parallel, and then
+ * count the edges and arcs in the order of the replicates.
+ */
+void StructureBootstrap::run()
+{
+  std::vector<gum::UndiGraph> skeletons(bootstrapSize_);
+  std::vector<gum::MixedGraph> pdags(bootstrapSize_);
+  const StructureBootstrapPolicy policy(*this, skeletons, pdags);
+  OT::TBBImplementation::ParallelFor(0, bootstrapSize_, policy);
+
+  const OT::UnsignedInteger dimension = data_.getDimension();
+  edgeFrequencies_ = OT::SquareMatrix(dimension);
+  arcFrequencies_ = OT::SquareMatrix(dimension);
+  if (bootstrapSize_ == 0)
+  {
+    done_ = true;
+    return;
+  }
+
+  const double weight = 1.0 / bootstrapSize_;
+  for (OT::UnsignedInteger b = 0; b < bootstrapSize_; ++b)
+  {
+    for (const auto &edge : skeletons[b].edges())
+    {
+      edgeFrequencies_(edge.first(), edge.second()) += weight;
+      edgeFrequencies_(edge.second(), edge.first()) += weight;
+    }
+    for (const auto &arc : pdags[b].arcs())
+      arcFrequencies_(arc.tail(), arc.head()) += weight;
+  }
+  done_ = true;
+}
+
+void StructureBootstrap::checkRun() const
+{
+  if (!done_)
+    throw OT::InvalidArgumentException(HERE)
+        << "Error: the bootstrap has not been run, call run() first";
+}
+
+OT::SquareMatrix StructureBootstrap::getEdgeFrequencies() const
+{
+  checkRun();
+  return edgeFrequencies_;
+}
+
+OT::SquareMatrix StructureBootstrap::getArcFrequencies() const
+{
+  checkRun();
+  return arcFrequencies_;
+}
+
+OT::UnsignedInteger StructureBootstrap::idFromName(const std::string &name) const
+{
+  const auto description = data_.getDescription();
+  for (OT::UnsignedInteger i = 0; i < description.getSize(); ++i)
+    if (description[i] == name)
+      return i;
+  throw OT::InvalidArgumentException(HERE)
+      << "Error: name '" << name << "' is not a valid name";
+}
+
+double StructureBootstrap::getEdgeFrequency(const std::string &x,
+    const std::string &y) const
+{
+  checkRun();
+  return edgeFrequencies_(idFromName(x), idFromName(y));
+}
+
+double StructureBootstrap::getArcFrequency(const std::string &x,
+    const std::string &y) const
+{
+  checkRun();
+  return arcFrequencies_(idFromName(x), idFromName(y));
+}
+
+OT::Description StructureBootstrap::getDescription() const
+{
+  return data_.getDescription();
+}
+
+std::string StructureBootstrap::__str__(const std::string &offset) const
+{
+  std::stringstream ss;
+  ss << offset << "StructureBootstrap(bootstrapSize=" << bootstrapSize_
+     << ", learner=" << (learner_ == LearnerTypes::PC ? "PC" : "MIIC")
+     << ", alpha=" << alpha_ << ", seed=" << seed_ << ")";
+  return ss.str();
+}
+
+} // namespace OTAGRUM
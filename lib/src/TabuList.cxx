@@ -98,6 +98,26 @@ OT::UnsignedInteger TabuList::getRestarts() const
   return restarts_;
 }
 
+void TabuList::setMonitor(LearningMonitor *monitor)
+{
+  control_.setMonitor(monitor);
+}
+
+void TabuList::setMaximumWallTime(const double maximumWallTime)
+{
+  control_.setMaximumWallTime(maximumWallTime);
+}
+
+double TabuList::getMaximumWallTime() const
+{
+  return control_.getMaximumWallTime();
+}
+
+bool TabuList::isInterrupted() const
+{
+  return control_.isInterrupted();
+}
+
 NamedDAG TabuList::learnDAG()
 {
   if(dag_done_)
@@ -105,22 +125,26 @@ NamedDAG TabuList::learnDAG()
     return NamedDAG(best_dag_, namesFromData());
   }
   TRACE("\n===== STARTING DAG LEARNING =====" << std::endl);
+  control_.start();
+  evaluations_ = 0;
   TRACE(" Initial DAG: " << best_dag_ << std::endl)
   TRACE(" Initial score: " << best_score_ << std::endl)
 
   TRACE("\n   == RUN 1 ==" << std::endl)
   gum::DAG dag = best_dag_;
-  double score = tabuListAlgo(dag);
+  double score = tabuListAlgo(dag, 0);
   TRACE("   Learned DAG: " << dag << std::endl)
   TRACE("   DAG score: " << score << std::endl)
   updateBest(dag, score);
 
   for(OT::UnsignedInteger i = 0; i < restarts_ - 1; ++i)
   {
+    if (control_.isInterrupted())
+      break;
     TRACE("\n   == RUN " << i + 2 << " ==" << std::endl)
     dag = randomDAG(info_.getDimension(), max_parents_);
     TRACE("   Initial DAG: " << dag << std::endl)
-    score = tabuListAlgo(dag);
+    score = tabuListAlgo(dag, i + 1);
     TRACE("   Learned DAG: " << dag << std::endl)
     TRACE("   Score: " << score << std::endl)
     updateBest(dag, score);
@@ -135,13 +159,16 @@ NamedDAG TabuList::learnDAG()
   return NamedDAG(best_dag_, namesFromData());
 }
 
-double TabuList::tabuListAlgo(gum::DAG &dag)
+// the DAG reached when interrupted is returned with its score
+double TabuList::tabuListAlgo(gum::DAG &dag, const OT::UnsignedInteger run)
 {
   tabu_list_.clear();
   double score = computeScore(dag);
   bool converged = false;
   while(!converged)
   {
+    if (control_.report("tabu", run, restarts_ - run - 1, evaluations_))
+      break;
     auto best_change = findBestChange(dag);
     TRACE("   Best change: (" << best_change.first << ", "
           << best_change.second << ")" << std::endl)
@@ -299,6 +326,7 @@ gum::learning::GraphChange TabuList::choseRandomChange(
 double TabuList::computeDeltaScore(const gum::DAG &dag, gum::learning::GraphChange change)
 {
   //std::cout << "ComputeDeltaScore" << std::endl;
+  ++evaluations_;
   switch(change.type())
   {
     case gum::learning::ARC_ADDITION:
@@ -0,0 +1,109 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ClusteredContinuousPC
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OTAGRUM_CLUSTEREDCONTINUOUSPC_HXX
+#define OTAGRUM_CLUSTEREDCONTINUOUSPC_HXX
+
+#include <memory>
+#include <vector>
+
+#include <agrum/base/graphs/mixedGraph.h>
+#include <agrum/base/graphs/undiGraph.h>
+
+#include <openturns/CorrelationMatrix.hxx>
+#include <openturns/Sample.hxx>
+
+#include "otagrum/ContinuousPC.hxx"
+#include "otagrum/NamedDAG.hxx"
+#include "otagrum/NamedJunctionTree.hxx"
+
+namespace OTAGRUM
+{
+
+/// PC algorithm run in overlapping clusters of variables, then merged and
+/// checked on the whole data
+class OTAGRUM_API ClusteredContinuousPC : public OT::Object
+{
+public:
+  explicit ClusteredContinuousPC(const OT::Sample &data,
+                                 const OT::UnsignedInteger maxConditioningSetSize = 5,
+                                 const double alpha = 0.1);
+
+  void setMaximumClusterSize(const OT::UnsignedInteger maximumClusterSize);
+  OT::UnsignedInteger getMaximumClusterSize() const;
+
+  void setOverlapSize(const OT::UnsignedInteger overlapSize);
+  OT::UnsignedInteger getOverlapSize() const;
+
+  /// lazy computation of the learnedSkeleton
+  gum::UndiGraph learnSkeleton();
+  /// lazy computation of the PDAG
+  gum::MixedGraph learnPDAG();
+  /// lazy computation of the junction tree
+  NamedJunctionTree learnJunctionTree();
+  /// lazy computation of the DAG
+  NamedDAG learnDAG();
+
+  /// the clusters (with their overlap) of the last learning
+  OT::UnsignedInteger getClustersNumber() const;
+  OT::Indices getCluster(const OT::UnsignedInteger i) const;
+
+  /// the learner checking the merged skeleton on the whole data
+  ContinuousPC getContinuousPC() const;
+
+  void setVerbosity(bool verbose);
+  bool getVerbosity() const;
+
+private:
+  friend struct ClusteredContinuousPCPolicy;
+
+  // result of the PC algorithm inside a cluster, in global ids
+  struct ClusterResult
+  {
+    std::vector<gum::Edge> kept;
+    std::vector<double> keptPValues;
+    std::vector<gum::Edge> removed;
+    std::vector<OT::Indices> sepsets;
+    std::vector<double> pvalues;
+  };
+
+  double getCorrelationPValue(const OT::UnsignedInteger x,
+                              const OT::UnsignedInteger y) const;
+  void buildClusters();
+  void learnCluster(const OT::UnsignedInteger i, ClusterResult &result) const;
+  void mergeClusters();
+
+  OT::Sample data_;
+  OT::UnsignedInteger maxCondSet_;
+  double alpha_;
+  OT::UnsignedInteger maxClusterSize_;
+  OT::UnsignedInteger overlapSize_;
+  bool verbose_;
+
+  OT::CorrelationMatrix spearman_;
+  std::vector<OT::Indices> clusters_;
+  // learner of the final check, built by mergeClusters
+  std::shared_ptr<ContinuousPC> pc_;
+  bool merged_;
+};
+
+} // namespace OTAGRUM
+#endif // OTAGRUM_CLUSTEREDCONTINUOUSPC_HXX
@@ -11,6 +11,8 @@
 #include "otagrum/NamedDAG.hxx"
 #include "otagrum/CorrectedMutualInformation.hxx"
 #include "otagrum/IndicesManip.hxx"
+#include "otagrum/IncrementalReachability.hxx"
+#include "otagrum/LearningMonitor.hxx"
 
 #include "otagrum/Greater.hxx"
 
@@ -21,6 +23,8 @@ class OTAGRUM_API ContinuousMIIC : public OT::Object
 public:
   // Constructor
   explicit ContinuousMIIC(const OT::Sample &data);
+  /// resume a run from a checkpoint file written by setCheckpointFile
+  ContinuousMIIC(const OT::Sample &data, const std::string &checkpointFile);
 
   gum::UndiGraph learnSkeleton();
   gum::MixedGraph learnPDAG();
@@ -36,6 +40,9 @@ public:
 
   void setCMode(CorrectedMutualInformation::CModeTypes cmode);
   void setKMode(CorrectedMutualInformation::KModeTypes kmode);
+  /// see CorrectedMutualInformation::setEntropyTolerance
+  void setEntropyTolerance(const double entropyTolerance);
+  double getEntropyTolerance() const;
 
   void setVerbosity(bool verbose);
   bool getVerbosity() const;
@@ -43,36 +50,81 @@ public:
   void setAlpha(double alpha);
   double getAlpha() const;
 
+  /// restrict the contributors of the iteration phase to the neighbours of
+  /// the ends of the edge
+  void setNeighbourContributors(const bool neighbourContributors);
+  bool getNeighbourContributors() const;
+  /// keep the contributorsNumber candidates with the largest pairwise
+  /// information with the ends of the edge (0 for all)
+  void setContributorsNumber(const OT::UnsignedInteger contributorsNumber);
+  OT::UnsignedInteger getContributorsNumber() const;
+
+  /// cut the edges whose rank correlation is negligible before the
+  /// initiation, see RankCorrelationScreening
+  void setRankScreening(const bool rankScreening);
+  bool getRankScreening() const;
+
+  /// monitor of the progress of the learning (not owned, nullptr for none)
+  void setMonitor(LearningMonitor *monitor);
+  /// the learning returns the graph found so far after maximumWallTime
+  /// seconds (0 for no limit)
+  void setMaximumWallTime(const double maximumWallTime);
+  double getMaximumWallTime() const;
+  /// true if the last learning has been stopped by the monitor or the budget
+  bool isInterrupted() const;
+
+  /// write the state of the iteration phase in fileName ("" to disable),
+  /// with the entropy cache if withCache
+  void setCheckpointFile(const std::string &fileName,
+                         const bool withCache = false);
+  std::string getCheckpointFile() const;
+
 private:
   void initiation();
   void iteration();
   void findBestContributor(const OT::UnsignedInteger X,
                            const OT::UnsignedInteger Y,
                            const OT::Indices &U);
-  std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger >*,
-      double,
-      double,
-      double > >
-      getUnshieldedTriples(const gum::MixedGraph& graph,
-                           gum::HashTable< std::pair< gum::NodeId, gum::NodeId >, char >& marks);
-
-  std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger >*,
-      double, double, double > >
-      updateProbaTriples(
-        const gum::MixedGraph& graph,
-        std::vector< std::tuple< std::tuple< OT::UnsignedInteger,
-        OT::UnsignedInteger,
-        OT::UnsignedInteger >*,
-        double, double, double > > proba_triples);
-
-  void propagatesHead(gum::MixedGraph& graph, gum::NodeId node);
-
-  bool existsDirectedPath(const gum::MixedGraph& graph,
-                          const OT::UnsignedInteger n1,
+  std::tuple<OT::UnsignedInteger, double, OT::UnsignedInteger>
+  computeBestContributor(CorrectedMutualInformation &info,
+                         const OT::UnsignedInteger X,
+                         const OT::UnsignedInteger Y,
+                         const OT::Indices &U) const;
+  void insertContributor(const OT::UnsignedInteger X,
+                         const OT::UnsignedInteger Y,
+                         const OT::UnsignedInteger Z,
+                         const OT::Indices &U,
+                         const double P);
+  struct InitiationPolicy;
+  std::vector<OT::UnsignedInteger> getContributorCandidates(const OT::UnsignedInteger X,
+      const OT::UnsignedInteger Y,
+      const OT::Indices &U);
+  double computeContributorProbability(CorrectedMutualInformation &info,
+                                       const OT::UnsignedInteger X,
+                                       const OT::UnsignedInteger Y,
+                                       const OT::UnsignedInteger Z,
+                                       const OT::Indices &U,
+                                       const double IXY_U,
+                                       const double IXYZ_U) const;
+  struct ContributorPolicy;
+  struct TripleGroup;
+  struct TriplePolicy;
+  std::vector< TripleRecord >
+  getUnshieldedTriples(const gum::MixedGraph& graph,
+                       gum::HashTable< std::pair< gum::NodeId, gum::NodeId >, char >& marks);
+
+  void updateProbaTriple(const gum::MixedGraph& graph, TripleRecord& triple) const;
+
+  void writeCheckpoint() const;
+  void readCheckpoint(const std::string &fileName);
+
+  void propagatesHead(gum::NodeId node);
+
+  // keep reachability_ in sync with the arcs of pdag_
+  void addPDAGArc(const gum::NodeId tail, const gum::NodeId head);
+  void erasePDAGArc(const gum::NodeId tail, const gum::NodeId head);
+
+  bool existsDirectedPath(const OT::UnsignedInteger n1,
                           const OT::UnsignedInteger n2,
                           const bool countArc = true) const;
 
@@ -82,26 +134,38 @@ private:
 
   int maxLog_ = 100;
   bool verbose_ = false;
+  bool neighbourContributors_ = false;
+  OT::UnsignedInteger contributorsNumber_ = 0;
+  bool rankScreening_ = false;
 
   bool skeleton_done_ = false;
   bool pdag_done_ = false;
   bool dag_done_ = false;
+  // the initiation has been done by the run resumed
+  bool resumed_ = false;
+
+  std::string checkpointFile_;
+  bool checkpointCache_ = false;
 
+  OT::Sample data_;
   CorrectedMutualInformation info_;
+  LearningControl control_;
+  // number of information computations of the skeleton learning : the
+  // 2-point information of each pair examined by the initiation or an
+  // iteration, and the 3-point information of each candidate contributor
+  OT::UnsignedInteger testsNumber_ = 0;
 
   gum::HashTable< std::pair< gum::NodeId, gum::NodeId >, char > initial_marks_;
   std::vector< gum::Arc > latent_couples_;
   gum::ArcProperty< double > arc_probas_;
   gum::EdgeProperty< OT::Indices > sepset_;
-  gum::Heap <
-  std::pair< std::tuple< OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::UnsignedInteger,
-      OT::Indices >*, double >,
-      GreaterPairOn2nd > rank_;
+  gum::Heap< ContributorRecord, GreaterContributor > rank_;
 
   gum::UndiGraph skeleton_;
   gum::MixedGraph pdag_;
+  IncrementalReachability reachability_;
+  // arcs of pdag_ added or erased since the last update of the triples
+  std::vector< gum::Arc > changedArcs_;
   NamedDAG dag_;
 };
 
@@ -0,0 +1,86 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ContinuousMarkovBlanket
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OTAGRUM_CONTINUOUSMARKOVBLANKET_HXX
+#define OTAGRUM_CONTINUOUSMARKOVBLANKET_HXX
+
+#include <string>
+#include <vector>
+
+#include <agrum/base/graphs/graphElements.h>
+#include <agrum/base/core/hashTable.h>
+
+#include <openturns/Sample.hxx>
+
+#include "otagrum/ContinuousTTest.hxx"
+
+namespace OTAGRUM
+{
+
+/// local discovery of the Markov blanket of target variables (MMPC + spouses)
+class OTAGRUM_API ContinuousMarkovBlanket : public OT::Object
+{
+public:
+  explicit ContinuousMarkovBlanket(const OT::Sample &data,
+                                   const OT::UnsignedInteger maxConditioningSetSize = 5,
+                                   const double alpha = 0.1);
+
+  /// parents and children of target (with symmetry correction)
+  OT::Indices getParentsAndChildren(const OT::UnsignedInteger target);
+  /// spouses of target : the other parents of its children
+  OT::Indices getSpouses(const OT::UnsignedInteger target);
+  /// parents, children and spouses of target
+  OT::Indices getMarkovBlanket(const OT::UnsignedInteger target);
+
+  std::vector<std::string> getParentsAndChildren(const std::string &target);
+  std::vector<std::string> getSpouses(const std::string &target);
+  std::vector<std::string> getMarkovBlanket(const std::string &target);
+
+  /// number of independence tests done so far
+  OT::UnsignedInteger getTestsNumber() const;
+
+  void setVerbosity(bool verbose);
+  bool getVerbosity() const;
+
+private:
+  OT::Indices candidateParentsAndChildren(const OT::UnsignedInteger target);
+  double maxPValue(const OT::UnsignedInteger target, const OT::UnsignedInteger x,
+                   const OT::Indices &conditioning, const OT::Indices &required,
+                   OT::Indices &sepset);
+  bool isIndep(const OT::UnsignedInteger x, const OT::UnsignedInteger y,
+               const OT::Indices &z, double &p);
+  std::vector<std::string> namesFromIds(const OT::Indices &ids) const;
+  OT::UnsignedInteger idFromName(const std::string &name) const;
+
+  ContinuousTTest tester_;
+  OT::UnsignedInteger maxCondSet_;
+  bool verbose_;
+  OT::UnsignedInteger tests_;
+
+  // results of the MMPC of each node already explored
+  gum::HashTable<OT::UnsignedInteger, OT::Indices> cpc_;
+  gum::HashTable<OT::UnsignedInteger, OT::Indices> pc_;
+  // separator of target and x found by the MMPC of target, by arc target->x
+  gum::ArcProperty<OT::Indices> sepset_;
+};
+
+} // namespace OTAGRUM
+#endif // OTAGRUM_CONTINUOUSMARKOVBLANKET_HXX
@@ -28,9 +28,14 @@
 #include <agrum/base/graphs/mixedGraph.h>
 #include <agrum/base/graphs/undiGraph.h>
 
+#include <future>
+#include <vector>
+
+#include <openturns/Point.hxx>
 #include <openturns/Sample.hxx>
 
 #include "otagrum/ContinuousTTest.hxx"
+#include "otagrum/LearningMonitor.hxx"
 #include "otagrum/NamedDAG.hxx"
 #include "otagrum/NamedJunctionTree.hxx"
 
@@ -44,6 +49,43 @@ public:
                         const OT::UnsignedInteger maxConditioningSetSize = 5,
                         const double alpha = 0.1);
 
+  /// warm start from a previous learner, with new rows appended to its data
+  ContinuousPC(const ContinuousPC &previous, const OT::Sample &newRows,
+               const double margin);
+
+  /// resume a run from a checkpoint file written by setCheckpointFile
+  ContinuousPC(const OT::Sample &data, const std::string &checkpointFile);
+
+  /// start the skeleton learning from skeleton instead of the complete graph
+  void setInitialSkeleton(const gum::UndiGraph &skeleton);
+  /// separator and p-value already known for an edge missing in the initial
+  /// skeleton
+  void setInitialSepset(const gum::NodeId x, const gum::NodeId y,
+                        const OT::Indices &sepset, const double pValue);
+  /// edge of the initial skeleton kept without test
+  void addFrozenEdge(const gum::NodeId x, const gum::NodeId y,
+                     const double pValue);
+
+  /// background knowledge : the edge x-y is never in the skeleton
+  void addForbiddenEdge(const gum::NodeId x, const gum::NodeId y);
+  void addForbiddenEdge(const std::string &x, const std::string &y);
+  /// background knowledge : the edge x-y is always in the skeleton
+  void addRequiredEdge(const gum::NodeId x, const gum::NodeId y);
+  void addRequiredEdge(const std::string &x, const std::string &y);
+  /// background knowledge : tiers[i] is the tier of the node i, no arc goes
+  /// from a tier to a lower one (empty to disable)
+  void setTiers(const OT::Indices &tiers);
+  OT::Indices getTiers() const;
+
+  /// write the state of inferSkeleton at each level boundary in fileName
+  /// ("" to disable), with the cache of log-pdfs if withCache
+  void setCheckpointFile(const std::string &fileName,
+                         const bool withCache = false);
+  std::string getCheckpointFile() const;
+
+  void setAlpha(const double alpha);
+  double getAlpha() const;
+
   /// lazy computation of the learnedSkeleton
   gum::UndiGraph learnSkeleton();
   /// lazy computation of the PDAG
@@ -53,9 +95,60 @@ public:
   /// lazy computation of the DAG
   NamedDAG learnDAG();
 
+  /// learn the skeleton, PDAG or DAG for each alpha of the sorted list alphas,
+  /// sharing the tests between the runs
+  std::vector<gum::UndiGraph> learnSkeletons(const OT::Point &alphas);
+  std::vector<gum::MixedGraph> learnPDAGs(const OT::Point &alphas);
+  std::vector<NamedDAG> learnDAGs(const OT::Point &alphas);
+
   void setVerbosity(bool verbose);
   bool getVerbosity() const;
 
+  /// monitor of the progress of the learning (not owned, nullptr for none)
+  void setMonitor(LearningMonitor *monitor);
+  /// the learning returns the skeleton found so far after maximumWallTime
+  /// seconds (0 for no limit)
+  void setMaximumWallTime(const double maximumWallTime);
+  double getMaximumWallTime() const;
+  /// true if the last learning has been stopped by the monitor or the budget
+  bool isInterrupted() const;
+  /// number of independence tests of the last learning
+  OT::UnsignedInteger getTestsNumber() const;
+
+  enum class SeparatorOrderingTypes {Lexicographic, Heuristic};
+
+  void setSeparatorOrdering(SeparatorOrderingTypes ordering);
+  SeparatorOrderingTypes getSeparatorOrdering() const;
+
+  void setGroupedScheduling(const bool grouped);
+  bool getGroupedScheduling() const;
+
+  void setPrefetch(const bool prefetch);
+  bool getPrefetch() const;
+
+  /// run the tests of each level in local worker processes (0 to disable)
+  void setWorkersNumber(const OT::UnsignedInteger workersNumber);
+  OT::UnsignedInteger getWorkersNumber() const;
+
+  void setMaximumTestsPerEdge(const OT::UnsignedInteger maximumTests);
+  OT::UnsignedInteger getMaximumTestsPerEdge() const;
+
+  void setMaximumTimePerEdge(const double maximumTime);
+  double getMaximumTimePerEdge() const;
+
+  void setSeed(const OT::UnsignedInteger seed);
+  OT::UnsignedInteger getSeed() const;
+
+  /// keep the results of the tests of size 0 in flat arrays, for data with
+  /// thousands of variables
+  void setHighDimension(const bool highDimension);
+  bool getHighDimension() const;
+
+  /// remove the pairs whose rank correlation is negligible before the tests,
+  /// see RankCorrelationScreening
+  void setRankScreening(const bool rankScreening);
+  bool getRankScreening() const;
+
   double getPValue(gum::NodeId x, gum::NodeId y) const;
   double getTTest(gum::NodeId x, gum::NodeId y) const;
   OT::Indices getSepset(gum::NodeId x, gum::NodeId y) const;
@@ -69,16 +162,84 @@ public:
   bool isRemoved(gum::NodeId x, gum::NodeId y) const;
   bool isRemoved(const std::string &x, const std::string &y) const;
 
+  bool isCapped(gum::NodeId x, gum::NodeId y) const;
+  bool isCapped(const std::string &x, const std::string &y) const;
+
   std::string skeletonToDot(const gum::UndiGraph &skeleton);
   std::string PDAGtoDot(const gum::MixedGraph &pdag);
 
   std::vector<std::string> getTrace() const;
 private:
-  bool testCondSetWithSize(gum::UndiGraph &g, OT::UnsignedInteger n);
+  /// log-pdfs computed ahead of the level that needs them
+  struct PrefetchedLogPDFs
+  {
+    std::vector<OT::Indices> sets;
+    OT::UnsignedInteger k;
+    std::vector<OT::Point> logPDFs;
+  };
+
+  void initWarmStart(const ContinuousPC &previous, const double margin);
+  void reclassifyWarmStart();
+  void writeCheckpoint(const gum::UndiGraph &g, OT::UnsignedInteger n) const;
+  void readCheckpoint(const std::string &fileName);
+
+  void checkNodes(const gum::NodeId x, const gum::NodeId y) const;
+  bool isFrozen(const gum::Edge &edge) const;
+  bool isPairRemoved(const gum::Edge &edge) const;
+  gum::UndiGraph testEmptyConditioningSet();
+  gum::NodeSet getCandidates(const gum::UndiGraph &g, gum::NodeId y,
+                             gum::NodeId z) const;
+  void applyConstraints(gum::UndiGraph &g);
+
+  bool testCondSetWithSize(gum::UndiGraph &g, OT::UnsignedInteger n,
+                           std::future<PrefetchedLogPDFs> *prefetch = nullptr);
+  bool testCondSetWithSizeGrouped(
+    gum::UndiGraph &g, OT::UnsignedInteger n,
+    const gum::EdgeProperty<gum::NodeSet> &intersections);
+  bool testCondSetWithSizeWorkers(
+    gum::UndiGraph &g, OT::UnsignedInteger n,
+    const gum::EdgeProperty<gum::NodeSet> &intersections);
+  bool storeSearchResult(gum::UndiGraph &g, const gum::Edge &edge,
+                         const bool found, const double t, const double p,
+                         const OT::Indices &sep);
+
+  std::tuple<double, double, bool> isIndep(gum::NodeId y, gum::NodeId z,
+                                           const OT::Indices &sep) const;
+  void startSweep(const OT::Point &alphas);
+  void endSweep(const double alpha);
+  /// alpha sweep in progress : the state of the learner is restored when it
+  /// is destroyed, even by an exception
+  class Sweep
+  {
+  public:
+    Sweep(ContinuousPC &learner, const OT::Point &alphas);
+    ~Sweep();
+
+  private:
+    ContinuousPC &learner_;
+    double alpha_;
+  };
 
   std::tuple<bool, double, double, OT::Indices>
   getSeparator(const gum::UndiGraph &g, gum::NodeId y, gum::NodeId z,
-               const OT::Indices &neighbours, OT::UnsignedInteger n) const;
+               const OT::Indices &neighbours, OT::UnsignedInteger n,
+               bool &capped) const;
+
+  std::vector<OT::Indices>
+  rankSeparators(gum::NodeId y, gum::NodeId z,
+                 const OT::Indices &neighbours, OT::UnsignedInteger n) const;
+  void sortSeparators(gum::NodeId y, gum::NodeId z,
+                      const OT::Indices &neighbours,
+                      std::vector<OT::Indices> &separators) const;
+  double getAssociation(gum::NodeId x, gum::NodeId y) const;
+  std::vector<OT::Indices>
+  sampleSeparators(gum::NodeId y, gum::NodeId z,
+                   const OT::Indices &neighbours, OT::UnsignedInteger n,
+                   OT::UnsignedInteger size) const;
+
+  std::future<PrefetchedLogPDFs> startPrefetch(const gum::UndiGraph &g,
+      OT::UnsignedInteger n) const;
+  void collectPrefetch(std::future<PrefetchedLogPDFs> &prefetch);
 
   std::vector<std::string> namesFromData(void) const;
 
@@ -95,12 +256,58 @@ private:
   gum::EdgeProperty<OT::Indices> sepset_;
   gum::EdgeProperty<double> pvalues_;
   gum::EdgeProperty<double> ttests_;
+  // t-statistics at the beginning of the level, for the heuristic ordering
+  gum::EdgeProperty<double> levelTTests_;
   std::vector<gum::Edge> removed_;
+  gum::EdgeSet capped_;
 
   OT::UnsignedInteger maxCondSet_;
   bool verbose_;
+  SeparatorOrderingTypes ordering_;
+  OT::UnsignedInteger maxTestsPerEdge_;
+  double maxTimePerEdge_;
+  OT::UnsignedInteger seed_;
+  bool grouped_;
+  bool prefetch_;
+  OT::UnsignedInteger workersNumber_;
+  bool rankScreening_;
+  // results of the tests of size 0 in the high-dimension mode, indexed by
+  // PairIndex
+  bool highDimension_;
+  std::vector<double> pairPValues_;
+  std::vector<double> pairTTests_;
+  std::vector<bool> pairRemoved_;
+  gum::HashTable<std::string, gum::NodeId> nameIds_;
+  LearningControl control_;
+  mutable OT::UnsignedInteger testsNumber_;
+  // t-statistics memoized during an alpha sweep
+  bool memoize_;
+  mutable gum::HashTable<std::string, double> memo_;
+  OT::Sample data_;
   ContinuousTTest tester_;
 
+  // starting point of inferSkeleton instead of the complete graph, with the
+  // results already known for its missing edges
+  bool warmStart_;
+  gum::UndiGraph initialSkeleton_;
+  gum::EdgeProperty<OT::Indices> initialSepset_;
+  gum::EdgeProperty<double> initialPValues_;
+  gum::EdgeProperty<double> initialTTests_;
+  std::vector<gum::Edge> initialRemoved_;
+  // edges of the initial skeleton that are kept without test
+  gum::EdgeSet frozen_;
+  gum::EdgeSet resumedCapped_;
+  // first size of conditioning sets tested by inferSkeleton
+  OT::UnsignedInteger startLevel_;
+
+  // background knowledge
+  gum::EdgeSet forbidden_;
+  gum::EdgeSet required_;
+  OT::Indices tiers_;
+
+  std::string checkpointFile_;
+  bool checkpointCache_;
+
   bool skel_done_, pdag_done_, dag_done_, jt_done_;
 
   gum::UndiGraph skel_;
@@ -22,6 +22,7 @@
 #ifndef OTAGRUM_CONTINUOUSTTEST_HXX
 #define OTAGRUM_CONTINUOUSTTEST_HXX
 
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -61,10 +62,38 @@ public:
 
   void clearCache() const;
   void clearCacheLevel(const OT::UnsignedInteger level) const;
+  /// removes from the cache the log-pdfs used by the test of Y,Z given X
+  void releaseLogPDFs(const OT::UnsignedInteger Y,
+                      const OT::UnsignedInteger Z,
+                      const OT::Indices & X) const;
   OT::UnsignedInteger getDimension() const;
 
   OT::Description getDataDescription() const;
 
+  /// writes/reads the content of the cache
+  void writeCache(std::ostream & os) const;
+  void readCache(std::istream & is) const;
+
+  /// k used by the tests with a conditioning set of the given size
+  OT::UnsignedInteger getK(const OT::UnsignedInteger conditioningSize) const;
+
+  /// computes the log-pdf of Bernstein Copula on Indice l, without the cache
+  /// (may be called concurrently)
+  OT::Point computeLogPDF(const OT::Indices & l,
+                          const OT::UnsignedInteger k) const;
+
+  /// computes in parallel the log-pdfs of sets, without the cache
+  std::vector<OT::Point> computeLogPDFs(const std::vector<OT::Indices> & sets,
+                                        const OT::UnsignedInteger k) const;
+
+  /// stores in the cache log-pdfs computed by computeLogPDFs
+  void storeLogPDFs(const std::vector<OT::Indices> & sets,
+                    const OT::UnsignedInteger k,
+                    const std::vector<OT::Point> & logPDFs) const;
+
+  /// true if the log-pdf of l is in the cache (or does not need it)
+  bool isCached(const OT::Indices & l, const OT::UnsignedInteger k) const;
+
   /// computes K from the sample properties (size, dimension, ...)
   static OT::UnsignedInteger GetK(const OT::UnsignedInteger size,
                                   const OT::UnsignedInteger dimension);
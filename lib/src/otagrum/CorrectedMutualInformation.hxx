@@ -1,9 +1,14 @@
 #ifndef OTAGRUM_CORRECTEDMUTUALINFORMATION_HXX
 #define OTAGRUM_CORRECTEDMUTUALINFORMATION_HXX
 
+#include <iostream>
+#include <utility>
+#include <vector>
+
 #include <agrum/base/core/hashTable.h>
 
 #include <openturns/Sample.hxx>
+#include <openturns/Distribution.hxx>
 #include <openturns/NormalCopula.hxx>
 
 #include "otagrum/NamedDAG.hxx"
@@ -27,6 +32,21 @@ public:
 
   void clearCaches() const;
 
+  /// writes/reads the content of the entropy cache
+  void writeCaches(std::ostream &os) const;
+  void readCaches(std::istream &is) const;
+
+  /// a copy with an empty cache which also reads the cache of this one;
+  /// several copies can compute in parallel while this one is not modified
+  CorrectedMutualInformation getLocalCopy() const;
+  /// adds the entries computed by a local copy to the cache
+  void mergeCaches(const CorrectedMutualInformation &local) const;
+
+  /// keep the entropies in the EntropyStore shared with the other instances
+  /// built on the same data instead of a private cache
+  void setUseEntropyStore(const bool useEntropyStore);
+  bool getUseEntropyStore() const;
+
   double compute2PtCorrectedInformation(const OT::UnsignedInteger X,
                                         const OT::UnsignedInteger Y,
                                         const OT::Indices &U = OT::Indices());
@@ -35,17 +55,39 @@ public:
                                         const OT::UnsignedInteger Y,
                                         const OT::UnsignedInteger Z,
                                         const OT::Indices &U = OT::Indices());
+  /// I(X;Y;Z|U) for each Z of Zs: the entropies of U+X, U+Y, U+X+Y and U
+  /// are computed once for all the Z
+  OT::Point compute3PtCorrectedInformations(const OT::UnsignedInteger X,
+      const OT::UnsignedInteger Y,
+      const OT::Indices &Zs,
+      const OT::Indices &U = OT::Indices());
+  /// the Z of the largest information of the last batch
+  OT::UnsignedInteger getBest3PtContributor() const;
 
   enum class KModeTypes {NoCorr, Naive};
-  enum class CModeTypes {Gaussian, Bernstein};
+  enum class CModeTypes {Gaussian, Bernstein, Histogram};
 
   void setKMode(CorrectedMutualInformation::KModeTypes kmode);
   void setCMode(CorrectedMutualInformation::CModeTypes cmode);
 
-  KModeTypes getKMode();
-  CModeTypes getCMode();
+  KModeTypes getKMode() const;
+  CModeTypes getCMode() const;
+
+  /// Histogram mode: add the Miller-Madow bias correction to the entropies
+  void setMillerMadowCorrection(const bool millerMadowCorrection);
+  bool getMillerMadowCorrection() const;
+
+  /// estimate the mean log-density of the copulas on random subsets of
+  /// points, grown until the standard error is below entropyTolerance * alpha
+  /// (0 to use all the points)
+  void setEntropyTolerance(const double entropyTolerance);
+  double getEntropyTolerance() const;
+  /// standard error of the last information computed, 0 if it is exact
+  double getInformationStandardError() const;
 
 private:
+  explicit CorrectedMutualInformation(const CorrectedMutualInformation *shared);
+
   void clearHCache() const;
 
   std::string GetKey(OT::Indices l) const;
@@ -55,6 +97,34 @@ private:
 
 
   double computeCrossEntropy(const OT::Indices &variables, const int K);
+  double computeMeanLogPDF(const OT::Distribution &copula,
+                           const OT::Sample &sample,
+                           double &standardError) const;
+  void addEntropyVariance(const std::string &key, const std::string &storeKey);
+  std::string getStorePrefix() const;
+
+  // Cholesky factor of the correlation of the normal scores of variables
+  struct GaussianFactor
+  {
+    OT::Indices variables;
+    // row i holds its i + 1 first coefficients
+    std::vector<double> lower;
+    double logDet = 0.0;
+  };
+  void computeNormalScores();
+  std::pair<double, double> getPairMoments(const OT::UnsignedInteger i,
+      const OT::UnsignedInteger j);
+  bool extendGaussianFactor(GaussianFactor &factor,
+                            const OT::UnsignedInteger variable);
+  void setGaussianPrefix(const OT::Indices &U);
+  void setGaussianPrefixes(const OT::Indices &U,
+                           const OT::UnsignedInteger X,
+                           const OT::UnsignedInteger Y);
+  bool computeGaussianEntropy(const OT::Indices &variables, double &H);
+
+  // entropy of the copula histogram with K bins per variable
+  double computeHistogramEntropy(const OT::Indices &variables,
+                                 const OT::UnsignedInteger K) const;
 
   double compute2PtInformation(const OT::UnsignedInteger X,
                                const OT::UnsignedInteger Y,
@@ -85,6 +155,26 @@ private:
   KModeTypes kmode_{KModeTypes::Naive};
   CModeTypes cmode_{CModeTypes::Bernstein};
   double alpha_ = 0.01;
+  bool millerMadowCorrection_ = true;
+  double entropyTolerance_ = 0.0;
+  // random order in which the points are evaluated by the subsampling
+  OT::Indices evaluationOrder_;
+  // standard errors of the subsampled entropies, by key of HCache_
+  mutable gum::HashTable< std::string, double > SECache_;
+  double informationVariance_ = 0.0;
+  // cache read by a local copy, not owned
+  const CorrectedMutualInformation *shared_ = nullptr;
+  bool useEntropyStore_ = false;
+  // prefix of the keys in the EntropyStore: fingerprint of the data
+  std::string fingerprint_;
+  // Gaussian mode: normal scores of the data, correlation and second moment
+  // of the scores of each pair, and factors of the last conditioning set
+  OT::Sample normalScores_;
+  mutable gum::HashTable< std::pair< gum::Size, gum::Size >, std::pair< double, double > > pairMoments_;
+  GaussianFactor prefix_;
+  // factors of U+X, U+Y and U+X+Y for the 3-point informations
+  std::vector< GaussianFactor > extensions_;
+  OT::UnsignedInteger best3PtContributor_ = 0;
 };
 
 }
@@ -0,0 +1,65 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief EntropyStore shares the entropies between the learners
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_ENTROPYSTORE_HXX
+#define OTAGRUM_ENTROPYSTORE_HXX
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <openturns/Sample.hxx>
+
+#include "otagrum/otagrumprivate.hxx"
+
+namespace OTAGRUM
+{
+
+/**
+ * Process-wide store of the entropies computed by CorrectedMutualInformation,
+ * keyed by the fingerprint of the data, the copula model and the set of
+ * variables (with K for the Bernstein copula). The learners built on the same
+ * data compute each entropy once. The least recently used entries are evicted
+ * beyond the maximum size, and all the methods can be called concurrently.
+ */
+class OTAGRUM_API EntropyStore
+{
+public:
+  /// the value stored under key, false if there is none
+  static bool Get(const std::string &key, double &value);
+  static void Set(const std::string &key, const double value);
+
+  /// the entries whose key starts with prefix, from the most recently used
+  static std::vector<std::pair<std::string, double> > GetEntries(const std::string &prefix);
+
+  static void Clear();
+  static OT::UnsignedInteger GetSize();
+
+  /// maximum number of entries, see EntropyStore-MaximumSize
+  static void SetMaximumSize(const OT::UnsignedInteger maximumSize);
+  static OT::UnsignedInteger GetMaximumSize();
+
+  /// a hash of the dimension, the size and the values of sample
+  static std::string GetFingerprint(const OT::Sample &sample);
+};
+
+} // namespace OTAGRUM
+
+#endif // OTAGRUM_ENTROPYSTORE_HXX
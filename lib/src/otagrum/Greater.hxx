@@ -1,45 +1,47 @@
 #ifndef OTAGRUM_GREATER_HXX
 #define OTAGRUM_GREATER_HXX
 
-#include <utility>    // std::pair
-#include <tuple>      // std::tuple
 #include <openturns/OT.hxx>  // OT::UnsignedInteger, OT::Indices
 
 namespace OTAGRUM
 {
 #ifndef SWIG
-class GreaterPairOn2nd
+/// the best contributor Z of the edge X-Y given U, and its score
+struct ContributorRecord
+{
+  OT::UnsignedInteger X = 0;
+  OT::UnsignedInteger Y = 0;
+  OT::UnsignedInteger Z = 0;
+  OT::Indices U;
+  double score = 0.0;
+};
+
+/// the unshielded triple X-Z-Y, its information and the probabilities of
+/// the heads X->Z and Y->Z; index is the order of discovery of the triple
+struct TripleRecord
+{
+  OT::UnsignedInteger X = 0;
+  OT::UnsignedInteger Y = 0;
+  OT::UnsignedInteger Z = 0;
+  double I = 0.0;
+  double PXZ = 0.5;
+  double PYZ = 0.5;
+  OT::UnsignedInteger index = 0;
+};
+
+class GreaterContributor
 {
 public:
-  bool operator()(
-    const std::pair <
-    std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::Indices >*,
-    double > & e1,
-    const std::pair <
-    std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::Indices >*,
-    double > & e2) const;
+  bool operator()(const ContributorRecord &e1,
+                  const ContributorRecord &e2) const;
 };
-#endif
 
-class GreaterTupleOnLast
+class GreaterTriple
 {
 public:
-  bool operator()(
-    const std::tuple< std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger >*,
-    double, double, double >& e1,
-    const std::tuple< std::tuple< OT::UnsignedInteger,
-    OT::UnsignedInteger,
-    OT::UnsignedInteger >*,
-    double, double, double >& e2) const;
+  bool operator()(const TripleRecord &e1, const TripleRecord &e2) const;
 };
+#endif
 
 }
 
@@ -0,0 +1,74 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief IncrementalReachability keeps the directed paths of a graph
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_INCREMENTALREACHABILITY_HXX
+#define OTAGRUM_INCREMENTALREACHABILITY_HXX
+
+#include <cstdint>
+#include <vector>
+
+#include <agrum/base/graphs/mixedGraph.h>
+
+#include "otagrum/otagrumprivate.hxx"
+
+namespace OTAGRUM
+{
+
+/**
+ * Transitive closure of the arcs of a graph, as one bitset of reachable nodes
+ * per node, updated as the arcs are added : the existence of a directed path
+ * is checked in constant time instead of a search in the graph.
+ *
+ * A pair of opposite arcs (a latent couple) is not part of any path. Adding
+ * an arc updates the closure in O(n^2/64), erasing one recomputes it at the
+ * next query.
+ */
+class OTAGRUM_API IncrementalReachability
+{
+public:
+  IncrementalReachability();
+  /// the closure of the arcs of graph, whose nodes are 0..n-1
+  explicit IncrementalReachability(const gum::MixedGraph &graph);
+
+  void addArc(const gum::NodeId tail, const gum::NodeId head);
+  void eraseArc(const gum::NodeId tail, const gum::NodeId head);
+
+  /// true if there is a directed path from x to y
+  bool existsPath(const gum::NodeId x, const gum::NodeId y) const;
+  /// true if there is a directed path from x to y other than the arc x->y
+  bool existsPathAvoidingArc(const gum::NodeId x, const gum::NodeId y) const;
+
+private:
+  bool isPathArc(const gum::NodeId tail, const gum::NodeId head) const;
+  bool reaches(const gum::NodeId x, const gum::NodeId y) const;
+  void addPathArc(const gum::NodeId tail, const gum::NodeId head);
+  void update() const;
+
+  OT::UnsignedInteger words_;
+  std::vector<gum::NodeSet> children_;
+  std::vector<gum::NodeSet> parents_;
+  // reach_[x] : the nodes at the end of a path from x
+  mutable std::vector<std::vector<std::uint64_t>> reach_;
+  mutable bool dirty_;
+};
+
+} // namespace OTAGRUM
+
+#endif // OTAGRUM_INCREMENTALREACHABILITY_HXX
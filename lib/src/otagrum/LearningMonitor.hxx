@@ -0,0 +1,89 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief LearningMonitor follows the progress of a structure learning
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_LEARNINGMONITOR_HXX
+#define OTAGRUM_LEARNINGMONITOR_HXX
+
+#include <string>
+
+#include <agrum/base/core/timer.h>
+
+#include <openturns/OTprivate.hxx>
+
+#include "otagrum/otagrumprivate.hxx"
+
+namespace OTAGRUM
+{
+
+/**
+ * Interface of the objects following the progress of a learner, see the
+ * setMonitor methods of ContinuousPC, ContinuousMIIC and TabuList. It can be
+ * derived in C++ or in Python.
+ */
+class OTAGRUM_API LearningMonitor
+{
+public:
+  LearningMonitor();
+  virtual ~LearningMonitor();
+
+  /// called by the learner as it progresses, returns true to stop it
+  virtual bool update(const std::string &phase,
+                      const OT::UnsignedInteger level,
+                      const OT::UnsignedInteger remaining,
+                      const OT::UnsignedInteger testsNumber);
+};
+
+/// the monitor and the wall-clock budget of a learner
+class OTAGRUM_API LearningControl
+{
+public:
+  LearningControl();
+
+  /// the monitor is not owned (nullptr for none)
+  void setMonitor(LearningMonitor *monitor);
+  LearningMonitor *getMonitor() const;
+
+  /// maximum duration of a learning in seconds (0 for no limit)
+  void setMaximumWallTime(const double maximumWallTime);
+  double getMaximumWallTime() const;
+
+  /// starts the clock of a learning
+  void start();
+
+  /// reports the progress to the monitor, returns true if the learning must
+  /// stop (then all the following reports return true until start)
+  bool report(const std::string &phase,
+              const OT::UnsignedInteger level,
+              const OT::UnsignedInteger remaining,
+              const OT::UnsignedInteger testsNumber);
+
+  /// true if the learning has been stopped by the monitor or the budget
+  bool isInterrupted() const;
+
+private:
+  LearningMonitor *monitor_;
+  double maximumWallTime_;
+  gum::Timer timer_;
+  bool interrupted_;
+};
+
+} // namespace OTAGRUM
+
+#endif // OTAGRUM_LEARNINGMONITOR_HXX
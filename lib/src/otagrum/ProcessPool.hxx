@@ -0,0 +1,86 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief ProcessPool runs jobs in local worker processes
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_PROCESSPOOL_HXX
+#define OTAGRUM_PROCESSPOOL_HXX
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <openturns/OTprivate.hxx>
+
+namespace OTAGRUM
+{
+
+/**
+ * Worker processes forked from the current one : they see its memory as it
+ * is when the pool is created (copy-on-write), so the data and the caches are
+ * shared without being copied. The requests are byte strings sent to the free
+ * workers through local sockets, the job is run on them in the workers and
+ * the responses are sent back.
+ *
+ * The workers only have the thread that created them : a lock held by
+ * another thread at the fork would stay locked in them. The pool is then only
+ * created when the TBB pool is limited to one thread (see IsForkSafe), no
+ * other thread being started by the library. The memory written by a job
+ * stays in its worker.
+ *
+ * Only available on Linux. After an error of run, the pool must be destroyed.
+ * This class is internal to the library, its header is not installed.
+ */
+class ProcessPool
+{
+public:
+  typedef std::function<std::string(const std::string &)> Job;
+
+  ProcessPool(const OT::UnsignedInteger workersNumber, const Job &job);
+  ~ProcessPool();
+
+  ProcessPool(const ProcessPool &) = delete;
+  ProcessPool &operator=(const ProcessPool &) = delete;
+
+  /// runs the job on each request, returns the responses in the order of the
+  /// requests
+  std::vector<std::string> run(const std::vector<std::string> &requests);
+
+  OT::UnsignedInteger getWorkersNumber() const;
+
+  /// true if worker processes can be created on this platform
+  static bool IsAvailable();
+
+  /// true if the process can be forked : the TBB pool has at most one thread
+  static bool IsForkSafe();
+
+private:
+  struct Worker
+  {
+    int pid;
+    int fd;
+  };
+
+  void stop();
+
+  std::vector<Worker> workers_;
+};
+
+} // namespace OTAGRUM
+
+#endif // OTAGRUM_PROCESSPOOL_HXX
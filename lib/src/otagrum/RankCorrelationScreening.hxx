@@ -0,0 +1,70 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief RankCorrelationScreening removes the negligible pairs of variables
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_RANKCORRELATIONSCREENING_HXX
+#define OTAGRUM_RANKCORRELATIONSCREENING_HXX
+
+#include <vector>
+
+#include <agrum/base/graphs/undiGraph.h>
+
+#include <openturns/Sample.hxx>
+
+#include "otagrum/otagrumprivate.hxx"
+
+namespace OTAGRUM
+{
+
+/**
+ * Screening of the pairs of variables before a structure learning: the
+ * Spearman correlations of all the pairs are computed by products of blocks
+ * of the standardized ranks, and the pairs whose correlation is not
+ * significant at the (conservative) p-value threshold are removed from the
+ * complete graph. A dependence without monotone trend is not seen.
+ */
+class OTAGRUM_API RankCorrelationScreening : public OT::Object
+{
+public:
+  explicit RankCorrelationScreening(const OT::Sample &data);
+
+  /// a pair is removed if the p-value of its Spearman correlation is larger,
+  /// see RankCorrelationScreening-PValueThreshold
+  void setPValueThreshold(const double pValueThreshold);
+  double getPValueThreshold() const;
+
+  /// the complete graph without the removed pairs
+  gum::UndiGraph computeSkeleton();
+
+  /// p-value of the Spearman correlation of x and y, after computeSkeleton
+  double getPValue(const gum::NodeId x, const gum::NodeId y) const;
+  bool isRemoved(const gum::NodeId x, const gum::NodeId y) const;
+
+private:
+  OT::UnsignedInteger getPairIndex(const gum::NodeId x, const gum::NodeId y) const;
+
+  OT::Sample data_;
+  double pValueThreshold_;
+  // p-values of the pairs, indexed by getPairIndex
+  std::vector<double> pValues_;
+};
+
+} // namespace OTAGRUM
+
+#endif // OTAGRUM_RANKCORRELATIONSCREENING_HXX
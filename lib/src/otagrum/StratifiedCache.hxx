@@ -23,6 +23,7 @@
 
 #include "otagrum/otagrumprivate.hxx"
 
+#include <iostream>
 #include <sstream>
 #include <string>
 
@@ -54,6 +55,8 @@ public:
 
   void set(OT::UnsignedInteger level, const std::string &key, const OT::Point sample);
 
+  void erase(OT::UnsignedInteger level, const std::string &key);
+
   void clearLevel(unsigned long level);
 
   void clear();
@@ -63,6 +66,10 @@ public:
 
   int maxLevel() const;
 
+  /// writes/reads the whole content, level by level
+  void write(std::ostream &os) const;
+  void read(std::istream &is);
+
   std::string __str__(const std::string& offset = "") const override;
 };
 } // OTAGRUM
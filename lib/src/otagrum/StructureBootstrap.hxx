@@ -0,0 +1,107 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief StructureBootstrap
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OTAGRUM_STRUCTUREBOOTSTRAP_HXX
+#define OTAGRUM_STRUCTUREBOOTSTRAP_HXX
+
+#include <vector>
+
+#include <agrum/base/graphs/mixedGraph.h>
+#include <agrum/base/graphs/undiGraph.h>
+
+#include <openturns/Indices.hxx>
+#include <openturns/Sample.hxx>
+#include <openturns/SquareMatrix.hxx>
+
+#include "otagrum/otagrumprivate.hxx"
+
+namespace OTAGRUM
+{
+
+/// learns structures on bootstrap resamples of the data and counts how often
+/// each edge and arc appears
+class OTAGRUM_API StructureBootstrap : public OT::Object
+{
+public:
+  enum class LearnerTypes {PC, MIIC};
+
+  explicit StructureBootstrap(const OT::Sample &data,
+                              const OT::UnsignedInteger bootstrapSize = 100,
+                              const LearnerTypes learner = LearnerTypes::PC);
+
+  void setBootstrapSize(const OT::UnsignedInteger bootstrapSize);
+  OT::UnsignedInteger getBootstrapSize() const;
+
+  void setLearner(const LearnerTypes learner);
+  LearnerTypes getLearner() const;
+
+  /// maximum size of the conditioning sets of ContinuousPC
+  void setMaximumConditioningSetSize(const OT::UnsignedInteger maxCondSet);
+  OT::UnsignedInteger getMaximumConditioningSetSize() const;
+
+  /// threshold of ContinuousPC or ContinuousMIIC
+  void setAlpha(const double alpha);
+  double getAlpha() const;
+
+  void setSeed(const OT::UnsignedInteger seed);
+  OT::UnsignedInteger getSeed() const;
+
+  /// learns the bootstrapSize structures
+  void run();
+
+  /// frequency of the edge x-y in the skeletons (symmetric)
+  OT::SquareMatrix getEdgeFrequencies() const;
+  /// frequency of the arc x->y in the PDAGs (compelled orientations only)
+  OT::SquareMatrix getArcFrequencies() const;
+
+  double getEdgeFrequency(const std::string &x, const std::string &y) const;
+  double getArcFrequency(const std::string &x, const std::string &y) const;
+
+  /// rows of the data drawn for the replicate b
+  OT::Indices getResampleIndices(const OT::UnsignedInteger b) const;
+
+  OT::Description getDescription() const;
+
+  std::string __str__(const std::string &offset = "") const override;
+
+private:
+  friend struct StructureBootstrapPolicy;
+
+  void learnReplicate(const OT::UnsignedInteger b, gum::UndiGraph &skeleton,
+                      gum::MixedGraph &pdag) const;
+  OT::UnsignedInteger idFromName(const std::string &name) const;
+  void checkRun() const;
+
+  OT::Sample data_;
+
+  OT::UnsignedInteger bootstrapSize_;
+  LearnerTypes learner_;
+  OT::UnsignedInteger maxCondSet_;
+  double alpha_;
+  OT::UnsignedInteger seed_;
+
+  bool done_;
+  OT::SquareMatrix edgeFrequencies_;
+  OT::SquareMatrix arcFrequencies_;
+};
+
+} // namespace OTAGRUM
+#endif // OTAGRUM_STRUCTUREBOOTSTRAP_HXX
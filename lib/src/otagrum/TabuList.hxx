@@ -10,6 +10,7 @@
 #include "otagrum/NamedDAG.hxx"
 #include "otagrum/CorrectedMutualInformation.hxx"
 #include "otagrum/IndicesManip.hxx"
+#include "otagrum/LearningMonitor.hxx"
 
 namespace OTAGRUM
 {
@@ -39,6 +40,15 @@ public:
 
   double getBestScore() const;
 
+  /// monitor of the progress of the learning (not owned, nullptr for none)
+  void setMonitor(LearningMonitor *monitor);
+  /// the learning returns the best DAG found so far after maximumWallTime
+  /// seconds (0 for no limit)
+  void setMaximumWallTime(const double maximumWallTime);
+  double getMaximumWallTime() const;
+  /// true if the last learning has been stopped by the monitor or the budget
+  bool isInterrupted() const;
+
   NamedDAG learnDAG();
 
 private:
@@ -67,10 +77,13 @@ private:
 
   std::pair< gum::learning::GraphChange, double > findBestChange(const gum::DAG &dag);
   void updateBest(const gum::DAG &dag, const double score);
-  double tabuListAlgo(gum::DAG &dag);
+  double tabuListAlgo(gum::DAG &dag, const OT::UnsignedInteger run);
 
 
   CorrectedMutualInformation info_;
+  LearningControl control_;
+  // number of score variations computed by the learning
+  OT::UnsignedInteger evaluations_ = 0;
   gum::DAG best_dag_;
   double best_score_;
 
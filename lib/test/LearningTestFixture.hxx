@@ -0,0 +1,148 @@
+//                                               -*- C++ -*-
+/**
+ *  @brief Shared fixture of the structure learning tests
+ *
+ *  Copyright 2010-2025 Airbus-LIP6-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef OTAGRUM_LEARNINGTESTFIXTURE_HXX
+#define OTAGRUM_LEARNINGTESTFIXTURE_HXX
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <openturns/NormalCopula.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+namespace LearningTest
+{
+
+/// correlation of the variables i and j
+struct Correlation
+{
+  OT::UnsignedInteger i;
+  OT::UnsignedInteger j;
+  double rho;
+};
+
+/// sample of the normal copula with the given correlations, the others being
+/// null, drawn from the seed 0
+inline OT::Sample NormalCopulaSample(const OT::UnsignedInteger dimension,
+                                     const std::vector<Correlation> &correlations,
+                                     const OT::UnsignedInteger size)
+{
+  OT::CorrelationMatrix R(dimension);
+  for (const auto &correlation : correlations)
+    R(correlation.i, correlation.j) = correlation.rho;
+  OT::RandomGenerator::SetSeed(0);
+  return OT::NormalCopula(R).getSample(size);
+}
+
+/// prints message if condition is false
+inline bool Check(const bool condition, const std::string &message)
+{
+  if (!condition)
+    std::cout << message << std::endl;
+  return condition;
+}
+
+inline bool CheckSameSkeleton(const gum::UndiGraph &skeleton,
+                              const gum::UndiGraph &expected,
+                              const std::string &what)
+{
+  return Check(skeleton == expected, what + " : " + skeleton.toString() +
+               " != " + expected.toString());
+}
+
+inline bool CheckSamePDAG(const gum::MixedGraph &pdag,
+                          const gum::MixedGraph &expected,
+                          const std::string &what)
+{
+  return Check(pdag == expected, what + " : " + pdag.toString() + " != " +
+               expected.toString());
+}
+
+inline bool CheckSameDAG(const OTAGRUM::NamedDAG &dag,
+                         const OTAGRUM::NamedDAG &expected,
+                         const std::string &what)
+{
+  return Check(dag.toDot() == expected.toDot(), what + " : " + dag.toDot() +
+               " != " + expected.toDot());
+}
+
+/// the separators of the pairs removed by expected are found by learner
+inline bool CheckSameSepsets(const OTAGRUM::ContinuousPC &learner,
+                             const OTAGRUM::ContinuousPC &expected,
+                             const OT::UnsignedInteger dimension,
+                             const std::string &what)
+{
+  for (gum::NodeId x = 0; x < dimension; ++x)
+    for (gum::NodeId y = x + 1; y < dimension; ++y)
+      if (expected.isRemoved(x, y) &&
+          !(learner.getSepset(x, y) == expected.getSepset(x, y)))
+      {
+        std::cout << what << " : sepset of " << x << "-" << y << " "
+                  << learner.getSepset(x, y) << " != "
+                  << expected.getSepset(x, y) << std::endl;
+        return false;
+      }
+  return true;
+}
+
+/// call raises an EXCEPTION
+template <class EXCEPTION, class CALL>
+bool CheckThrows(const CALL &call, const std::string &what)
+{
+  try
+  {
+    call();
+  }
+  catch (const EXCEPTION &)
+  {
+    return true;
+  }
+  std::cout << what << " accepted" << std::endl;
+  return false;
+}
+
+/// stops the learning at the given level of a phase (of any phase if empty)
+class Stopper : public OTAGRUM::LearningMonitor
+{
+public:
+  Stopper(const std::string &phase, const OT::UnsignedInteger level)
+    : phase_(phase), level_(level)
+  {
+  }
+
+  bool update(const std::string &phase,
+              const OT::UnsignedInteger level,
+              const OT::UnsignedInteger /*remaining*/,
+              const OT::UnsignedInteger /*testsNumber*/) override
+  {
+    return (phase_.empty() || (phase == phase_)) && (level >= level_);
+  }
+
+private:
+  std::string phase_;
+  OT::UnsignedInteger level_;
+};
+
+} // namespace LearningTest
+
+#endif // OTAGRUM_LEARNINGTESTFIXTURE_HXX
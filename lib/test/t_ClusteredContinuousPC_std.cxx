@@ -0,0 +1,28 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// two independent chains learned in separate clusters give the skeleton of
+// the PC algorithm on the whole data
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            6, {{0, 1, 0.7}, {1, 2, 0.7}, {0, 2, 0.49},
+                              {3, 4, 0.7}, {4, 5, 0.7}, {3, 5, 0.49}}, 500));
+
+  OTAGRUM::ClusteredContinuousPC clustered(sample, 2, 0.05);
+  clustered.setMaximumClusterSize(3);
+  clustered.setOverlapSize(0);
+  const auto skel = clustered.learnSkeleton();
+
+  OTAGRUM::ContinuousPC learner(sample, 2, 0.05);
+  if (!CheckSameSkeleton(skel, learner.learnSkeleton(), "clustered") ||
+      !Check(clustered.getClustersNumber() == 2, "wrong number of clusters"))
+    return EXIT_FAILURE;
+  // the edges inside the clusters are not tested again
+  const auto testsNumber = clustered.getContinuousPC().getTestsNumber();
+  if (!Check(testsNumber < learner.getTestsNumber(), std::to_string(testsNumber) +
+             " tests to check the merged skeleton"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
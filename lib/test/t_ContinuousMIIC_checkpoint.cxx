@@ -0,0 +1,42 @@
+#include <cstdio>
+
+#include <openturns/ResourceMap.hxx>
+
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// a learner resumed from a checkpoint written in the middle of the iteration
+// phase gives the results of the uninterrupted learner
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            5, {{0, 1, 0.8}, {1, 2, 0.8}, {0, 2, 0.64},
+                              {2, 3, 0.8}, {1, 3, 0.64}, {0, 3, 0.512}}, 500));
+  const std::string fileName = "t_ContinuousMIIC_checkpoint.txt";
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-CheckpointPeriod", 1);
+
+  OTAGRUM::ContinuousMIIC reference(sample);
+  const auto skel = reference.learnSkeleton();
+  const auto dag = reference.learnDAG();
+
+  for (const bool withCache : {true, false})
+  {
+    Stopper stopper("iteration", 1);
+    OTAGRUM::ContinuousMIIC interrupted(sample);
+    interrupted.setCheckpointFile(fileName, withCache);
+    interrupted.setMonitor(&stopper);
+    interrupted.learnSkeleton();
+    if (!Check(interrupted.isInterrupted(), "not interrupted"))
+      return EXIT_FAILURE;
+
+    OTAGRUM::ContinuousMIIC resumed(sample, fileName);
+    const auto skelResumed = resumed.learnSkeleton();
+    const auto dagResumed = resumed.learnDAG();
+    std::remove(fileName.c_str());
+    if (!CheckSameSkeleton(skelResumed, skel, "resumed") ||
+        !CheckSameDAG(dagResumed, dag, "resumed"))
+      return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,30 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// a mandatory arc of the collider 0->2<-1 updates the triples of its edge
+// as an oriented arc: the DAG is the one learned without constraint
+int main(void)
+{
+  // 2 = 0.6 * 0 + 0.6 * 1 + e, 3 = 0.7 * 2 + e
+  const OT::Sample sample(NormalCopulaSample(
+                            4, {{0, 2, 0.6}, {1, 2, 0.6}, {2, 3, 0.7},
+                              {0, 3, 0.42}, {1, 3, 0.42}}, 1000));
+
+  OTAGRUM::ContinuousMIIC unconstrained(sample);
+  unconstrained.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  const auto dag = unconstrained.learnDAG();
+
+  // the arc 0->2
+  OTAGRUM::ContinuousMIIC constrained(sample);
+  constrained.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  constrained.addMandatoryArc(0, 2);
+  const auto constrainedDAG = constrained.learnDAG();
+
+  const gum::DAG graph(constrainedDAG.getDAG());
+  if (!Check(graph.existsArc(0, 2) && graph.existsArc(1, 2) && graph.existsArc(2, 3)
+             && (graph.sizeArcs() == 3), "wrong DAG " + constrainedDAG.toDot()) ||
+      !CheckSameDAG(constrainedDAG, dag, "mandatory arc"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include <algorithm>
+
+#include <openturns/ResourceMap.hxx>
+
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// records the number of information computations reported by the learner
+class TestsCounter : public OTAGRUM::LearningMonitor
+{
+public:
+  bool update(const std::string & /*phase*/,
+              const OT::UnsignedInteger /*level*/,
+              const OT::UnsignedInteger /*remaining*/,
+              const OT::UnsignedInteger testsNumber) override
+  {
+    testsNumber_ = std::max(testsNumber_, testsNumber);
+    return false;
+  }
+
+  OT::UnsignedInteger testsNumber_ = 0;
+};
+
+// the parallel initiation, contributor search and triple evaluation give
+// the same graphs whatever the batch sizes
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            6, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4},
+                              {3, 4, 0.5}, {1, 5, 0.3}}, 500));
+
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-InitiationBatchSize", 1);
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-TriplesBatchSize", 1);
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-ContributorsBatchSize", 1);
+  OTAGRUM::ContinuousMIIC serial(sample);
+  serial.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  const auto skel = serial.learnSkeleton();
+  const auto dag = serial.learnDAG();
+
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-InitiationBatchSize", 7);
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-TriplesBatchSize", 3);
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousMIIC-ContributorsBatchSize", 2);
+  OTAGRUM::ContinuousMIIC parallel(sample);
+  parallel.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  if (!CheckSameSkeleton(parallel.learnSkeleton(), skel, "parallel") ||
+      !CheckSameDAG(parallel.learnDAG(), dag, "parallel"))
+    return EXIT_FAILURE;
+
+  // a prefilter larger than the number of candidates changes nothing
+  OTAGRUM::ContinuousMIIC prefiltered(sample);
+  prefiltered.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  prefiltered.setContributorsNumber(10);
+  if (!CheckSameSkeleton(prefiltered.learnSkeleton(), skel, "prefiltered"))
+    return EXIT_FAILURE;
+
+  OTAGRUM::ContinuousMIIC pruned(sample);
+  pruned.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  pruned.setNeighbourContributors(true);
+  pruned.setContributorsNumber(2);
+  if (!Check(pruned.learnDAG().getSize() == sample.getDimension(), "wrong pruned DAG"))
+    return EXIT_FAILURE;
+
+  // in the diamond 0->1->3, 0->2->3 the edge 0-3 needs both 1 and 2 as
+  // contributors; a cap of one candidate keeps 2, the most informative one,
+  // among the independent nodes 4 to 7
+  const OT::Sample diamondSample(NormalCopulaSample(
+                                   8, {{0, 1, 0.6}, {0, 2, 0.6}, {1, 2, 0.36},
+                                     {1, 3, 0.544}, {2, 3, 0.544}, {0, 3, 0.48}}, 1000));
+
+  TestsCounter allCounter;
+  OTAGRUM::ContinuousMIIC all(diamondSample);
+  all.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  all.setMonitor(&allCounter);
+  const auto allDAG = all.learnDAG();
+
+  TestsCounter cappedCounter;
+  OTAGRUM::ContinuousMIIC capped(diamondSample);
+  capped.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  capped.setContributorsNumber(1);
+  capped.setMonitor(&cappedCounter);
+  const auto cappedSkel = capped.learnSkeleton();
+  if (!Check(!cappedSkel.existsEdge(0, 3), "edge 0-3 kept by the capped search") ||
+      !CheckSameSkeleton(cappedSkel, all.learnSkeleton(), "capped") ||
+      !CheckSameDAG(capped.learnDAG(), allDAG, "capped") ||
+      !Check(cappedCounter.testsNumber_ < allCounter.testsNumber_,
+             "no candidate removed by the cap: " +
+             std::to_string(cappedCounter.testsNumber_) + " computations against " +
+             std::to_string(allCounter.testsNumber_)))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
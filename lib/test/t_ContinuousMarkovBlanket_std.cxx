@@ -0,0 +1,35 @@
+#include <iostream>
+
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// v-structure 0->2<-1, 2->3 and an independent 4 : the blanket of 0 is {1,2}
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger size = 1000;
+  const OT::Sample noise(OT::Normal(5).getSample(size));
+  OT::Sample sample(size, 5);
+  for (OT::UnsignedInteger i = 0; i < size; ++i)
+  {
+    sample(i, 0) = noise(i, 0);
+    sample(i, 1) = noise(i, 1);
+    sample(i, 2) = noise(i, 0) + noise(i, 1) + 0.5 * noise(i, 2);
+    sample(i, 3) = sample(i, 2) + 0.5 * noise(i, 3);
+    sample(i, 4) = noise(i, 4);
+  }
+
+  OTAGRUM::ContinuousMarkovBlanket learner(sample, 2, 0.05);
+  const auto blanket = learner.getMarkovBlanket(0);
+  OT::Indices expected(2);
+  expected[0] = 1;
+  expected[1] = 2;
+  if (!(blanket == expected))
+  {
+    std::cout << "blanket of 0 : " << blanket << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
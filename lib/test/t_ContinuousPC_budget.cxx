@@ -0,0 +1,75 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the budgets per edge cap the searches, and leave the result unchanged when
+// they are not reached
+int main(void)
+{
+  // all the pairs stay dependent given one node
+  const OT::UnsignedInteger dimension = 6;
+  std::vector<Correlation> correlations;
+  for (OT::UnsignedInteger i = 0; i < dimension; ++i)
+    for (OT::UnsignedInteger j = 0; j < i; ++j)
+      correlations.push_back({i, j, 0.5});
+  const OT::Sample sample(NormalCopulaSample(dimension, correlations, 300));
+
+  OTAGRUM::ContinuousPC reference(sample, 2, 0.05);
+  const auto skel = reference.learnSkeleton();
+  const auto testsNumber = reference.getTestsNumber();
+
+  // each edge of the level 1 has 4 candidates, only one is tested
+  OTAGRUM::ContinuousPC capped(sample, 2, 0.05);
+  capped.setMaximumTestsPerEdge(1);
+  capped.setSeparatorOrdering(
+    OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic);
+  const auto cappedSkel = capped.learnSkeleton();
+  const auto &cappedEdge = *cappedSkel.edges().begin();
+  if (!Check(capped.getTestsNumber() < testsNumber, "capped tests : " +
+             std::to_string(capped.getTestsNumber()) + " of " + std::to_string(testsNumber)) ||
+      !Check(capped.isCapped(cappedEdge.first(), cappedEdge.second()), "edge not capped"))
+    return EXIT_FAILURE;
+  OTAGRUM::ContinuousPC again(sample, 2, 0.05);
+  again.setMaximumTestsPerEdge(1);
+  again.setSeparatorOrdering(
+    OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic);
+  if (!CheckSameSkeleton(again.learnSkeleton(), cappedSkel, "sampling not reproducible"))
+    return EXIT_FAILURE;
+
+  // a change of budget after a learning is taken into account
+  OTAGRUM::ContinuousPC relearned(sample, 2, 0.05);
+  relearned.setSeparatorOrdering(
+    OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic);
+  relearned.learnSkeleton();
+  relearned.setMaximumTestsPerEdge(1);
+  if (!CheckSameSkeleton(relearned.learnSkeleton(), cappedSkel, "budget set after a learning") ||
+      !Check(relearned.getTestsNumber() == capped.getTestsNumber(), "budget set after a learning : " +
+             std::to_string(relearned.getTestsNumber()) + " tests"))
+    return EXIT_FAILURE;
+  relearned.setMaximumTestsPerEdge(0);
+  if (!Check(!relearned.isCapped(cappedEdge.first(), cappedEdge.second()),
+             "capped edge kept after a change of budget") ||
+      !CheckSameSkeleton(relearned.learnSkeleton(), skel, "budget removed after a learning"))
+    return EXIT_FAILURE;
+
+  OTAGRUM::ContinuousPC large(sample, 2, 0.05);
+  large.setMaximumTestsPerEdge(100);
+  if (!CheckSameSkeleton(large.learnSkeleton(), skel, "large budget of tests"))
+    return EXIT_FAILURE;
+
+  // the time budget stops the searches after their first test
+  OTAGRUM::ContinuousPC hurried(sample, 2, 0.05);
+  hurried.setMaximumTimePerEdge(1e-12);
+  const auto hurriedSkel = hurried.learnSkeleton();
+  const auto &hurriedEdge = *hurriedSkel.edges().begin();
+  if (!Check(hurried.getTestsNumber() < testsNumber, "hurried tests : " +
+             std::to_string(hurried.getTestsNumber()) + " of " + std::to_string(testsNumber)) ||
+      !Check(hurried.isCapped(hurriedEdge.first(), hurriedEdge.second()), "edge not hurried"))
+    return EXIT_FAILURE;
+
+  OTAGRUM::ContinuousPC patient(sample, 2, 0.05);
+  patient.setMaximumTimePerEdge(1e6);
+  if (!CheckSameSkeleton(patient.learnSkeleton(), skel, "large budget of time"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+#include <cstdio>
+
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// a learner resumed from a checkpoint gives the results of the uninterrupted
+// learner
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            5, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4}, {3, 4, 0.5}}, 500));
+  const std::string fileName = "t_ContinuousPC_checkpoint.txt";
+
+  OTAGRUM::ContinuousPC reference(sample, 3, 0.1);
+  const auto skel = reference.learnSkeleton();
+
+  // from the last checkpoint of a complete run
+  OTAGRUM::ContinuousPC learner(sample, 3, 0.1);
+  learner.setCheckpointFile(fileName, true);
+  learner.learnSkeleton();
+  OTAGRUM::ContinuousPC resumed(sample, fileName);
+  const auto skelResumed = resumed.learnSkeleton();
+  std::remove(fileName.c_str());
+  if (!CheckSameSkeleton(skelResumed, skel, "resumed") ||
+      !Check(resumed.getTrace() == reference.getTrace(), "different resumed traces"))
+    return EXIT_FAILURE;
+
+  // from the checkpoint of a run interrupted at the beginning of the level 1,
+  // with and without the cache of log-pdfs
+  for (const bool withCache : {true, false})
+  {
+    Stopper stopper("", 1);
+    OTAGRUM::ContinuousPC interrupted(sample, 3, 0.1);
+    interrupted.setCheckpointFile(fileName, withCache);
+    interrupted.setMonitor(&stopper);
+    interrupted.learnSkeleton();
+    if (!Check(interrupted.isInterrupted(), "not interrupted"))
+      return EXIT_FAILURE;
+    OTAGRUM::ContinuousPC midRun(sample, fileName);
+    const auto skelMidRun = midRun.learnSkeleton();
+    std::remove(fileName.c_str());
+    if (!CheckSameSkeleton(skelMidRun, skel, "resumed mid-run") ||
+        !Check(midRun.getTrace() == reference.getTrace(), "different mid-run traces"))
+      return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
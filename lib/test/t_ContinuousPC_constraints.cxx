@@ -0,0 +1,32 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the background knowledge is enforced in the skeleton and in the PDAG
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            4, {{0, 1, 0.6}, {1, 2, 0.6}, {0, 2, 0.36},
+                              {2, 3, 0.6}, {1, 3, 0.36}, {0, 3, 0.216}}, 500));
+
+  OTAGRUM::ContinuousPC learner(sample, 2, 0.05);
+  learner.addForbiddenEdge(0, 1);
+  learner.addRequiredEdge(0, 3);
+  OT::Indices tiers(4);
+  tiers[2] = 1;
+  tiers[3] = 1;
+  learner.setTiers(tiers);
+
+  const auto skel = learner.learnSkeleton();
+  if (!Check(!skel.existsEdge(0, 1) && skel.existsEdge(0, 3), "skeleton : " + skel.toString()))
+    return EXIT_FAILURE;
+  const auto pdag = learner.learnPDAG();
+  if (!Check(!pdag.existsArc(3, 0) && (!skel.existsEdge(1, 2) || pdag.existsArc(1, 2)),
+             "pdag : " + pdag.toString()))
+    return EXIT_FAILURE;
+
+  const auto requireForbidden = [&learner]() { learner.addRequiredEdge(1, 0); };
+  if (!CheckThrows<OT::InvalidArgumentException>(requireForbidden, "required forbidden edge"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
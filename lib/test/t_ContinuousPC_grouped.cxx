@@ -0,0 +1,49 @@
+#include <openturns/TBB.hxx>
+
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the grouped scheduling finds the skeleton and the separators of the tests
+// edge by edge, for both orderings of the candidates
+int main(void)
+{
+  // 0 -> 1 -> 2 -> 3 -> 4, and 0 -> 2
+  const OT::UnsignedInteger dimension = 5;
+  const OT::Sample sample(NormalCopulaSample(
+                            dimension, {{0, 1, 0.6}, {1, 2, 0.72}, {0, 2, 0.66},
+                              {2, 3, 0.5}, {1, 3, 0.36}, {0, 3, 0.33}, {3, 4, 0.5},
+                              {2, 4, 0.25}, {1, 4, 0.18}, {0, 4, 0.165}}, 500));
+
+  for (const auto ordering :
+       {OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Lexicographic,
+        OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic})
+  {
+    OTAGRUM::ContinuousPC serial(sample, 3, 0.05);
+    serial.setSeparatorOrdering(ordering);
+    const auto skel = serial.learnSkeleton();
+    OTAGRUM::ContinuousPC grouped(sample, 3, 0.05);
+    grouped.setSeparatorOrdering(ordering);
+    grouped.setGroupedScheduling(true);
+    if (!CheckSameSkeleton(grouped.learnSkeleton(), skel, "grouped") ||
+        !CheckSameSepsets(grouped, serial, dimension, "grouped"))
+      return EXIT_FAILURE;
+  }
+
+  // the worker processes do not group the tests
+  OT::TBB::SetThreadsNumber(1);
+  OTAGRUM::ContinuousPC workers(sample, 3, 0.05);
+  try
+  {
+    workers.setWorkersNumber(2);
+  }
+  catch (const OT::NotYetImplementedException &)
+  {
+    // no worker processes on this platform
+    return EXIT_SUCCESS;
+  }
+  const auto group = [&workers]() { workers.setGroupedScheduling(true); };
+  if (!CheckThrows<OT::InvalidArgumentException>(group, "grouped scheduling with the workers"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
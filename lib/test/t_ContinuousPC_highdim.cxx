@@ -0,0 +1,41 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the removed pairs and their p-values of learner are the ones of reference
+bool CheckSamePairs(const OTAGRUM::ContinuousPC &learner,
+                    const OTAGRUM::ContinuousPC &reference,
+                    const std::string &what)
+{
+  for (gum::NodeId i = 0; i < 5; ++i)
+    for (gum::NodeId j = 0; j < i; ++j)
+      if (!Check((learner.isRemoved(i, j) == reference.isRemoved(i, j)) &&
+                 (learner.getPValue(i, j) == reference.getPValue(i, j)),
+                 what + " : pair " + std::to_string(i) + "-" + std::to_string(j) + " differs"))
+        return false;
+  return CheckSameSepsets(learner, reference, 5, what);
+}
+
+// the high-dimension mode learns the same graphs and p-values
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(5, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4}}, 300));
+
+  OTAGRUM::ContinuousPC reference(sample, 2, 0.1);
+  OTAGRUM::ContinuousPC learner(sample, 2, 0.1);
+  learner.setHighDimension(true);
+
+  const auto expected = reference.learnPDAG();
+  if (!CheckSamePDAG(learner.learnPDAG(), expected, "high dimension") ||
+      !CheckSamePairs(learner, reference, "high dimension"))
+    return EXIT_FAILURE;
+
+  // a change of mode after a learning learns again in the new mode
+  reference.setHighDimension(true);
+  learner.setHighDimension(false);
+  if (!CheckSamePDAG(reference.learnPDAG(), expected, "high dimension set after a learning") ||
+      !CheckSamePDAG(learner.learnPDAG(), expected, "high dimension unset after a learning") ||
+      !CheckSamePairs(learner, reference, "change of mode"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,40 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the heuristic ordering tests the most associated separators first, and the
+// ones with an unknown association last
+int main(void)
+{
+  // 0 -> 2 -> 3, and 1 is a noisy copy of 2 : both {1} and {2} separate 0 and 3
+  const OT::Sample sample(NormalCopulaSample(
+                            4, {{0, 2, 0.6}, {2, 3, 0.6}, {0, 3, 0.36},
+                              {1, 2, 0.99}, {0, 1, 0.594}, {1, 3, 0.594}}, 500));
+
+  // the required edges are not tested : the association of 1 with 0 and 3 is
+  // unknown, so {2} is tested before {1}
+  OTAGRUM::ContinuousPC learner(sample, 2, 0.01);
+  learner.addRequiredEdge(0, 1);
+  learner.addRequiredEdge(1, 3);
+  learner.setSeparatorOrdering(
+    OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic);
+  const auto skel = learner.learnSkeleton();
+  if (!Check(!skel.existsEdge(0, 3), "skeleton : " + skel.toString()) ||
+      !Check(learner.getSepset(0, 3) == OT::Indices(1, 2),
+             "sepset of 0-3 : " + learner.getSepset(0, 3).__str__()))
+    return EXIT_FAILURE;
+
+  // a change of ordering after a learning is taken into account
+  OTAGRUM::ContinuousPC relearned(sample, 2, 0.01);
+  relearned.addRequiredEdge(0, 1);
+  relearned.addRequiredEdge(1, 3);
+  relearned.learnSkeleton();
+  relearned.setSeparatorOrdering(
+    OTAGRUM::ContinuousPC::SeparatorOrderingTypes::Heuristic);
+  relearned.learnSkeleton();
+  if (!Check(relearned.getSepset(0, 3) == OT::Indices(1, 2),
+             "sepset of 0-3 after the change of ordering : " +
+             relearned.getSepset(0, 3).__str__()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
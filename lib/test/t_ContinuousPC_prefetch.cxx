@@ -0,0 +1,29 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the prefetch of the next level leaves the results unchanged
+int main(void)
+{
+  const OT::UnsignedInteger dimension = 6;
+  std::vector<Correlation> correlations;
+  for (OT::UnsignedInteger i = 1; i < dimension; ++i)
+    correlations.push_back({i - 1, i, 0.6});
+  for (OT::UnsignedInteger i = 2; i < dimension; ++i)
+    correlations.push_back({i - 2, i, 0.36});
+  const OT::Sample sample(NormalCopulaSample(dimension, correlations, 300));
+
+  OTAGRUM::ContinuousPC reference(sample, 3, 0.05);
+  const auto skel = reference.learnSkeleton();
+  OTAGRUM::ContinuousPC learner(sample, 3, 0.05);
+  learner.setPrefetch(true);
+  if (!CheckSameSkeleton(learner.learnSkeleton(), skel, "prefetch") ||
+      !CheckSameSepsets(learner, reference, dimension, "prefetch"))
+    return EXIT_FAILURE;
+
+  // the grouped scheduling does not prefetch
+  const auto group = [&learner]() { learner.setGroupedScheduling(true); };
+  if (!CheckThrows<OT::InvalidArgumentException>(group, "grouped scheduling with prefetch"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
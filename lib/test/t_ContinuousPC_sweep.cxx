@@ -0,0 +1,28 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the skeletons of an alpha sweep are the ones of independent runs
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(4, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4}}, 500));
+
+  OT::Point alphas;
+  alphas.add(0.01);
+  alphas.add(0.1);
+  alphas.add(0.5);
+
+  OTAGRUM::ContinuousPC sweeper(sample, 2, 0.2);
+  const auto skeletons = sweeper.learnSkeletons(alphas);
+  if (!Check(sweeper.getAlpha() == 0.2, "alpha not restored"))
+    return EXIT_FAILURE;
+
+  for (OT::UnsignedInteger i = 0; i < alphas.getSize(); ++i)
+  {
+    OTAGRUM::ContinuousPC learner(sample, 2, alphas[i]);
+    if (!CheckSameSkeleton(skeletons[i], learner.learnSkeleton(),
+                           "alpha=" + std::to_string(alphas[i])))
+      return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
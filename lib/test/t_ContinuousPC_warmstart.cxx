@@ -0,0 +1,43 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// a warm start gives the skeleton of a cold run, and keeps the background
+// knowledge of the previous learner
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            4, {{0, 1, 0.6}, {1, 2, 0.6}, {0, 2, 0.36},
+                              {2, 3, 0.6}, {1, 3, 0.36}, {0, 3, 0.216}}, 500));
+  OT::Sample first(sample);
+  const OT::Sample newRows(first.split(400));
+
+  // with a margin covering all the decisions, the warm start is a cold run
+  OTAGRUM::ContinuousPC cold(sample, 2, 0.05);
+  OTAGRUM::ContinuousPC start(first, 2, 0.05);
+  start.learnSkeleton();
+  OTAGRUM::ContinuousPC warm(start, newRows, 1.0);
+  if (!CheckSameSkeleton(warm.learnSkeleton(), cold.learnSkeleton(), "warm start"))
+    return EXIT_FAILURE;
+
+  // the kept decisions are revised when alpha changes
+  OTAGRUM::ContinuousPC narrow(start, newRows, 0.0);
+  narrow.setAlpha(0.2);
+  narrow.learnSkeleton();
+  for (gum::NodeId x = 0; x < 4; ++x)
+    for (gum::NodeId y = x + 1; y < 4; ++y)
+      if (!Check(!narrow.isRemoved(x, y) || (narrow.getPValue(x, y) >= 0.2),
+                 std::to_string(x) + "-" + std::to_string(y) + " removed with p-value " +
+                 std::to_string(narrow.getPValue(x, y))))
+        return EXIT_FAILURE;
+
+  OTAGRUM::ContinuousPC previous(first, 2, 0.05);
+  previous.addRequiredEdge(0, 3);
+  previous.learnSkeleton();
+
+  OTAGRUM::ContinuousPC learner(previous, newRows, 0.01);
+  const auto skel = learner.learnSkeleton();
+  if (!Check(skel.existsEdge(0, 3), "skeleton : " + skel.toString()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+#include <openturns/ResourceMap.hxx>
+#include <openturns/TBB.hxx>
+
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the tests run in worker processes give the results of the serial run
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(
+                            5, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4}, {3, 4, 0.3}}, 300));
+
+  OTAGRUM::ContinuousPC reference(sample, 3, 0.1);
+  const auto expected = reference.learnPDAG();
+
+  OT::ResourceMap::SetAsUnsignedInteger("ContinuousPC-WorkersBatchSize", 2);
+  OTAGRUM::ContinuousPC learner(sample, 3, 0.1);
+  // the process is not forked while several TBB threads run
+  if (OT::TBB::IsAvailable())
+  {
+    OT::TBB::SetThreadsNumber(2);
+    try
+    {
+      learner.setWorkersNumber(3);
+      std::cout << "workers accepted with 2 TBB threads" << std::endl;
+      return EXIT_FAILURE;
+    }
+    catch (const OT::InvalidArgumentException &)
+    {
+      // expected
+    }
+    catch (const OT::NotYetImplementedException &)
+    {
+      // no worker processes on this platform
+      return EXIT_SUCCESS;
+    }
+  }
+  OT::TBB::SetThreadsNumber(1);
+  try
+  {
+    learner.setWorkersNumber(3);
+  }
+  catch (const OT::NotYetImplementedException &)
+  {
+    // no worker processes on this platform
+    return EXIT_SUCCESS;
+  }
+  if (!CheckSamePDAG(learner.learnPDAG(), expected, "workers") ||
+      !Check(learner.getTrace() == reference.getTrace(), "different traces"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+#include <iostream>
+
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// the batched 3-point informations are those of the single calls
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 6;
+  OT::CorrelationMatrix R(dim);
+  for (OT::UnsignedInteger i = 1; i < dim; ++i)
+    R(i, i - 1) = 0.4;
+  R(3, 0) = 0.3;
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(300));
+
+  const OT::UnsignedInteger X = 0, Y = 1;
+  OT::Indices U;
+  U.add(5);
+  OT::Indices Zs;
+  Zs.add(2);
+  Zs.add(3);
+  Zs.add(4);
+
+  const OTAGRUM::CorrectedMutualInformation::CModeTypes modes[] =
+  {
+    OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian,
+    OTAGRUM::CorrectedMutualInformation::CModeTypes::Bernstein,
+    OTAGRUM::CorrectedMutualInformation::CModeTypes::Histogram
+  };
+  for (const auto mode : modes)
+  {
+    OTAGRUM::CorrectedMutualInformation single(sample);
+    single.setCMode(mode);
+    OTAGRUM::CorrectedMutualInformation batch(sample);
+    batch.setCMode(mode);
+    const OT::Point computed(batch.compute3PtCorrectedInformations(X, Y, Zs, U));
+    OT::UnsignedInteger best = 0;
+    for (OT::UnsignedInteger i = 0; i < Zs.getSize(); ++i)
+    {
+      const double expected = single.compute3PtCorrectedInformation(X, Y, Zs[i], U);
+      if (computed[i] != expected)
+      {
+        std::cout << "mode " << static_cast<int>(mode) << ", Z=" << Zs[i] << ": I="
+                  << computed[i] << " expected " << expected << std::endl;
+        return EXIT_FAILURE;
+      }
+      if (expected > computed[best])
+        best = i;
+    }
+    if (batch.getBest3PtContributor() != Zs[best])
+    {
+      std::cout << "mode " << static_cast<int>(mode) << ": best Z=" << batch.getBest3PtContributor()
+                << " expected " << Zs[best] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
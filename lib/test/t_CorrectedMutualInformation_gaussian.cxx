@@ -0,0 +1,55 @@
+#include <cmath>
+#include <iostream>
+
+#include <openturns/Normal.hxx>
+#include <openturns/NormalCopulaFactory.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// entropy of the normal copula fitted on the variables, from the sample
+double Entropy(const OT::Sample &ranks, const OT::Indices &variables)
+{
+  if (variables.getSize() < 2)
+    return 0.0;
+  const OT::Sample marginal(ranks.getMarginal(variables));
+  const OT::NormalCopula copula(OT::NormalCopulaFactory().buildAsNormalCopula(marginal));
+  return -copula.computeLogPDF(marginal).computeMean()[0];
+}
+
+// the closed form of the Gaussian mode gives the entropies of the fitted copulas
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 5;
+  OT::CorrelationMatrix R(dim);
+  for (OT::UnsignedInteger i = 0; i < dim; ++i)
+    for (OT::UnsignedInteger j = 0; j < i; ++j)
+      R(i, j) = (i + j + 1.0) / (4.0 * dim);
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(400));
+  const OT::Sample ranks((sample.rank() + 1) / (sample.getSize() + 2));
+
+  OTAGRUM::CorrectedMutualInformation info(sample);
+  info.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Gaussian);
+  info.setKMode(OTAGRUM::CorrectedMutualInformation::KModeTypes::NoCorr);
+
+  const OT::UnsignedInteger X = 0, Y = 1, Z = 2;
+  OT::Indices U;
+  U.add(3);
+  U.add(4);
+  const double expected2 = Entropy(ranks, U + X) + Entropy(ranks, U + Y)
+                           - Entropy(ranks, U + X + Y) - Entropy(ranks, U);
+  const double computed2 = info.compute2PtCorrectedInformation(X, Y, U);
+  const double expected3 = Entropy(ranks, U + X) + Entropy(ranks, U + Y) + Entropy(ranks, U + Z)
+                           - Entropy(ranks, U + X + Y) - Entropy(ranks, U + X + Z)
+                           - Entropy(ranks, U + Y + Z) + Entropy(ranks, U + X + Y + Z)
+                           - Entropy(ranks, U);
+  const double computed3 = info.compute3PtCorrectedInformation(X, Y, Z, U);
+  if ((std::abs(computed2 - expected2) > 1e-10) || (std::abs(computed3 - expected3) > 1e-10))
+  {
+    std::cout << "I2=" << computed2 << " expected " << expected2
+              << ", I3=" << computed3 << " expected " << expected3 << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
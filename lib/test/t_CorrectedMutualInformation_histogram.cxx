@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// plug-in mutual information of the K x K histogram of two columns of ranks,
+// the margins of a copula being uniform
+double Information(const OT::Sample &ranks, const OT::UnsignedInteger X,
+                   const OT::UnsignedInteger Y, const OT::UnsignedInteger K)
+{
+  const OT::UnsignedInteger size = ranks.getSize();
+  std::map<std::pair<OT::UnsignedInteger, OT::UnsignedInteger>, double> joint;
+  for (OT::UnsignedInteger i = 0; i < size; ++i)
+  {
+    const OT::UnsignedInteger binX = std::min(K - 1, static_cast<OT::UnsignedInteger>(ranks(i, X) * K));
+    const OT::UnsignedInteger binY = std::min(K - 1, static_cast<OT::UnsignedInteger>(ranks(i, Y) * K));
+    joint[std::make_pair(binX, binY)] += 1.0 / size;
+  }
+  double I = 0.0;
+  for (const auto &cell : joint)
+    I += cell.second * std::log(cell.second * K * K);
+  return I;
+}
+
+// the Histogram mode gives the mutual information of the binned copula
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 3;
+  OT::CorrelationMatrix R(dim);
+  R(1, 0) = 0.8;
+  const OT::UnsignedInteger size = 1000;
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(size));
+  const OT::Sample ranks((sample.rank() + 1) / (size + 2));
+
+  OTAGRUM::CorrectedMutualInformation info(sample);
+  info.setCMode(OTAGRUM::CorrectedMutualInformation::CModeTypes::Histogram);
+  info.setKMode(OTAGRUM::CorrectedMutualInformation::KModeTypes::NoCorr);
+  info.setMillerMadowCorrection(false);
+
+  const OT::UnsignedInteger X = 0, Y = 1, Z = 2;
+  const OT::UnsignedInteger K = OT::UnsignedInteger(1.0 + std::pow(size, 2.0 / 6.0));
+  const double expected = Information(ranks, X, Y, K);
+  const double computed = info.compute2PtCorrectedInformation(X, Y);
+  const double independent = info.compute2PtCorrectedInformation(X, Z);
+  if ((std::abs(computed - expected) > 1e-10) || (computed < 0.3) || (independent > 0.05))
+  {
+    std::cout << "I(X;Y)=" << computed << " expected " << expected
+              << ", I(X;Z)=" << independent << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the correction removes a part of the positive bias of independent pairs
+  info.setMillerMadowCorrection(true);
+  const double corrected = info.compute2PtCorrectedInformation(X, Z);
+  if (corrected >= independent)
+  {
+    std::cout << "corrected I(X;Z)=" << corrected << " uncorrected " << independent << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
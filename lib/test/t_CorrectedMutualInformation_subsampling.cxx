@@ -0,0 +1,55 @@
+#include <cmath>
+#include <iostream>
+
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// the subsampled Bernstein entropies stop at the tolerance and agree with
+// the exact ones within their standard error
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 3;
+  OT::CorrelationMatrix R(dim);
+  R(1, 0) = 0.6;
+  R(2, 1) = 0.3;
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(2000));
+  const OT::UnsignedInteger X = 0, Y = 1, Z = 2;
+
+  OTAGRUM::CorrectedMutualInformation exact(sample);
+  const double expected = exact.compute2PtCorrectedInformation(X, Y);
+  const double expected3 = exact.compute3PtCorrectedInformation(X, Y, Z);
+  if (exact.getInformationStandardError() != 0.0)
+  {
+    std::cout << "standard error " << exact.getInformationStandardError() << " without subsampling" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  OTAGRUM::CorrectedMutualInformation subsampled(sample);
+  const double tolerance = 3.0;
+  subsampled.setEntropyTolerance(tolerance);
+  const double computed = subsampled.compute2PtCorrectedInformation(X, Y);
+  const double standardError = subsampled.getInformationStandardError();
+  if ((standardError <= 0.0) || (standardError > tolerance * subsampled.getAlpha())
+      || (std::abs(computed - expected) > 5.0 * standardError))
+  {
+    std::cout << "I=" << computed << " expected " << expected
+              << ", standard error " << standardError << std::endl;
+    return EXIT_FAILURE;
+  }
+  // the cached entropies keep their standard error
+  const double computed3 = subsampled.compute3PtCorrectedInformation(X, Y, Z);
+  const double standardError3 = subsampled.getInformationStandardError();
+  subsampled.compute2PtCorrectedInformation(X, Y);
+  if ((subsampled.getInformationStandardError() != standardError)
+      || (std::abs(computed3 - expected3) > 5.0 * standardError3))
+  {
+    std::cout << "cached standard error " << subsampled.getInformationStandardError()
+              << " expected " << standardError << ", I3=" << computed3
+              << " expected " << expected3 << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
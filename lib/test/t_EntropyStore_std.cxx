@@ -0,0 +1,101 @@
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// the instances on the same data share the entropies of the store
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 4;
+  OT::CorrelationMatrix R(dim);
+  for (OT::UnsignedInteger i = 1; i < dim; ++i)
+    R(i, i - 1) = 0.5;
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(300));
+
+  const OT::UnsignedInteger X = 0, Y = 1, Z = 2;
+  OT::Indices U;
+  U.add(3);
+
+  OTAGRUM::CorrectedMutualInformation reference(sample);
+  const double expected2 = reference.compute2PtCorrectedInformation(X, Y, U);
+  const double expected3 = reference.compute3PtCorrectedInformation(X, Y, Z, U);
+
+  OTAGRUM::EntropyStore::Clear();
+  OTAGRUM::CorrectedMutualInformation first(sample);
+  first.setUseEntropyStore(true);
+  const double first2 = first.compute2PtCorrectedInformation(X, Y, U);
+  const double first3 = first.compute3PtCorrectedInformation(X, Y, Z, U);
+  const OT::UnsignedInteger size = OTAGRUM::EntropyStore::GetSize();
+
+  // a second learner finds all its entropies in the store
+  OTAGRUM::CorrectedMutualInformation second(sample);
+  second.setUseEntropyStore(true);
+  const double second2 = second.compute2PtCorrectedInformation(X, Y, U);
+  const double second3 = second.compute3PtCorrectedInformation(X, Y, Z, U);
+
+  if ((size == 0) || (OTAGRUM::EntropyStore::GetSize() != size)
+      || (std::abs(first2 - expected2) > 1e-12) || (std::abs(first3 - expected3) > 1e-12)
+      || (second2 != first2) || (second3 != first3))
+  {
+    std::cout << "size=" << size << " then " << OTAGRUM::EntropyStore::GetSize()
+              << ", I2=" << first2 << " " << second2 << " expected " << expected2
+              << ", I3=" << first3 << " " << second3 << " expected " << expected3 << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the written caches hold the entries of the store, which are read back
+  // into the store or into a private cache
+  std::stringstream caches;
+  first.writeCaches(caches);
+  const std::string written(caches.str());
+  OTAGRUM::EntropyStore::Clear();
+  OTAGRUM::CorrectedMutualInformation resumed(sample);
+  resumed.setUseEntropyStore(true);
+  resumed.readCaches(caches);
+  const OT::UnsignedInteger readSize = OTAGRUM::EntropyStore::GetSize();
+  const double resumed3 = resumed.compute3PtCorrectedInformation(X, Y, Z, U);
+  OTAGRUM::CorrectedMutualInformation privateCache(sample);
+  std::istringstream privateCaches(written);
+  privateCache.readCaches(privateCaches);
+  if ((readSize != size) || (OTAGRUM::EntropyStore::GetSize() != size)
+      || (resumed3 != first3)
+      || (privateCache.compute3PtCorrectedInformation(X, Y, Z, U) != first3))
+  {
+    std::cout << "caches " << written << " read as " << readSize << " entries"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // other data do not hit the entries of the first sample
+  const OT::Sample other(OT::Normal(dim).getSample(300));
+  if (OTAGRUM::EntropyStore::GetFingerprint(other) == OTAGRUM::EntropyStore::GetFingerprint(sample))
+  {
+    std::cout << "same fingerprint for different samples" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the least recently used entries are evicted
+  const OT::UnsignedInteger maximumSize = OTAGRUM::EntropyStore::GetMaximumSize();
+  OTAGRUM::EntropyStore::SetMaximumSize(2);
+  double H = 0.0;
+  OTAGRUM::EntropyStore::Set("a", 1.0);
+  OTAGRUM::EntropyStore::Set("b", 2.0);
+  OTAGRUM::EntropyStore::Get("a", H);
+  OTAGRUM::EntropyStore::Set("c", 3.0);
+  const bool evicted = !OTAGRUM::EntropyStore::Get("b", H);
+  const bool kept = OTAGRUM::EntropyStore::Get("a", H) && (H == 1.0);
+  if ((OTAGRUM::EntropyStore::GetSize() != 2) || !evicted || !kept)
+  {
+    std::cout << "size=" << OTAGRUM::EntropyStore::GetSize()
+              << " evicted=" << evicted << " kept=" << kept << std::endl;
+    return EXIT_FAILURE;
+  }
+  OTAGRUM::EntropyStore::SetMaximumSize(maximumSize);
+  OTAGRUM::EntropyStore::Clear();
+  return EXIT_SUCCESS;
+}
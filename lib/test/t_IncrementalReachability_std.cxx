@@ -0,0 +1,75 @@
+#include <iostream>
+
+#include <openturns/RandomGenerator.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// search of a path from n1 to n2 through the arcs which are not double arcs
+bool Search(const gum::MixedGraph &graph, const gum::NodeId n1,
+            const gum::NodeId n2, const bool countArc)
+{
+  std::vector<gum::NodeId> stack(1, n2);
+  gum::NodeSet mark;
+  mark.insert(n2);
+  while (!stack.empty())
+  {
+    const gum::NodeId current = stack.back();
+    stack.pop_back();
+    for (const auto parent : graph.parents(current))
+    {
+      if (!countArc && (current == n2) && (parent == n1))
+        continue;
+      if (mark.contains(parent) || graph.existsArc(current, parent))
+        continue;
+      if (parent == n1)
+        return true;
+      mark.insert(parent);
+      stack.push_back(parent);
+    }
+  }
+  return false;
+}
+
+// random insertions and removals of arcs, compared to a search in the graph
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const gum::NodeId size = 70;
+  gum::MixedGraph graph;
+  for (gum::NodeId node = 0; node < size; ++node)
+    graph.addNodeWithId(node);
+  graph.addArc(0, 1);
+  OTAGRUM::IncrementalReachability reachability(graph);
+
+  for (OT::UnsignedInteger step = 0; step < 400; ++step)
+  {
+    const gum::NodeId tail = OT::RandomGenerator::IntegerGenerate(size);
+    const gum::NodeId head = OT::RandomGenerator::IntegerGenerate(size);
+    if (tail == head)
+      continue;
+    if ((step % 5 == 0) && graph.existsArc(tail, head) && !graph.existsArc(head, tail))
+    {
+      graph.eraseArc(gum::Arc(tail, head));
+      reachability.eraseArc(tail, head);
+    }
+    // keep the arcs acyclic, except for double arcs
+    else if (graph.existsArc(head, tail) || !Search(graph, head, tail, true))
+    {
+      graph.addArc(tail, head);
+      reachability.addArc(tail, head);
+    }
+    for (gum::NodeId x = 0; x < size; x += 7)
+      for (gum::NodeId y = 0; y < size; ++y)
+      {
+        if (x == y)
+          continue;
+        if ((reachability.existsPath(x, y) != Search(graph, x, y, true))
+            || (reachability.existsPathAvoidingArc(x, y) != Search(graph, x, y, false)))
+        {
+          std::cout << "path " << x << "->" << y << " differs at step " << step << std::endl;
+          return EXIT_FAILURE;
+        }
+      }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// stops the learning after a number of calls
+class CallsStopper : public OTAGRUM::LearningMonitor
+{
+public:
+  explicit CallsStopper(const OT::UnsignedInteger maximumCalls)
+    : calls_(0), maximumCalls_(maximumCalls)
+  {
+  }
+
+  bool update(const std::string & /*phase*/,
+              const OT::UnsignedInteger /*level*/,
+              const OT::UnsignedInteger /*remaining*/,
+              const OT::UnsignedInteger /*testsNumber*/) override
+  {
+    ++calls_;
+    return calls_ > maximumCalls_;
+  }
+
+  OT::UnsignedInteger calls_;
+  OT::UnsignedInteger maximumCalls_;
+};
+
+// an interrupted learning returns a valid partial result
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(4, {{0, 1, 0.6}, {1, 2, 0.5}, {2, 3, 0.4}}, 300));
+
+  OTAGRUM::ContinuousPC reference(sample, 2, 0.1);
+  const auto expected = reference.learnSkeleton();
+
+  CallsStopper stopper(3);
+  OTAGRUM::ContinuousPC learner(sample, 2, 0.1);
+  learner.setMonitor(&stopper);
+  const auto skel = learner.learnSkeleton();
+  learner.learnDAG();
+  if (!Check(learner.isInterrupted() && (learner.getTestsNumber() <= 3),
+             "ContinuousPC not interrupted"))
+    return EXIT_FAILURE;
+  // the edges not tested yet are kept
+  for (const auto &edge : expected.edges())
+    if (!Check(skel.existsEdge(edge), "edge " + std::to_string(edge.first()) + "-" +
+               std::to_string(edge.second()) + " removed"))
+      return EXIT_FAILURE;
+
+  CallsStopper miicStopper(0);
+  OTAGRUM::ContinuousMIIC miic(sample);
+  miic.setMonitor(&miicStopper);
+  miic.learnDAG();
+  if (!Check(miic.isInterrupted(), "ContinuousMIIC not interrupted"))
+    return EXIT_FAILURE;
+
+  OTAGRUM::TabuList tabu(sample, 2, 3, 2);
+  tabu.setMaximumWallTime(1e-9);
+  tabu.learnDAG();
+  if (!Check(tabu.isInterrupted(), "TabuList not interrupted"))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,63 @@
+#include <cmath>
+#include <iostream>
+
+#include <openturns/DistFunc.hxx>
+#include <openturns/Normal.hxx>
+#include <openturns/RandomGenerator.hxx>
+#include <openturns/ResourceMap.hxx>
+
+#include "otagrum/otagrum.hxx"
+
+// the blocked products give the Spearman correlations, and the learners
+// only test the pairs kept by the screening
+int main(void)
+{
+  OT::RandomGenerator::SetSeed(0);
+  const OT::UnsignedInteger dim = 7;
+  OT::CorrelationMatrix R(dim);
+  R(1, 0) = 0.6;
+  R(2, 1) = 0.6;
+  R(2, 0) = 0.36;
+  const OT::UnsignedInteger size = 500;
+  const OT::Sample sample(OT::Normal(OT::Point(dim), OT::Point(dim, 1.0), R).getSample(size));
+
+  // blocks smaller than the dimension
+  OT::ResourceMap::SetAsUnsignedInteger("RankCorrelationScreening-BlockSize", 3);
+  OTAGRUM::RankCorrelationScreening screening(sample);
+  const gum::UndiGraph skeleton(screening.computeSkeleton());
+  const OT::CorrelationMatrix spearman(sample.computeSpearmanCorrelation());
+  for (gum::NodeId i = 0; i < dim; ++i)
+    for (gum::NodeId j = 0; j < i; ++j)
+    {
+      const double expected = 2.0 * OT::DistFunc::pNormal(-std::abs(spearman(i, j)) * std::sqrt(size - 1.0));
+      if ((std::abs(screening.getPValue(i, j) - expected) > 1e-10)
+          || (skeleton.existsEdge(i, j) == screening.isRemoved(i, j)))
+      {
+        std::cout << "pair " << i << "-" << j << ": p=" << screening.getPValue(i, j)
+                  << " expected " << expected << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  if (!skeleton.existsEdge(0, 1) || !skeleton.existsEdge(1, 2))
+  {
+    std::cout << "dependent pairs removed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the screened pairs are removed with an empty separator
+  OTAGRUM::ContinuousPC pc(sample, 2, 0.1);
+  pc.setRankScreening(true);
+  const gum::UndiGraph learned(pc.learnSkeleton());
+  OTAGRUM::ContinuousMIIC miic(sample);
+  miic.setRankScreening(true);
+  const gum::UndiGraph miicLearned(miic.learnSkeleton());
+  for (gum::NodeId i = 0; i < dim; ++i)
+    for (gum::NodeId j = 0; j < i; ++j)
+      if (screening.isRemoved(i, j)
+          && (learned.existsEdge(i, j) || miicLearned.existsEdge(i, j) || (pc.getSepset(i, j).getSize() != 0)))
+      {
+        std::cout << "screened pair " << i << "-" << j << " kept" << std::endl;
+        return EXIT_FAILURE;
+      }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,30 @@
+#include "LearningTestFixture.hxx"
+
+using namespace LearningTest;
+
+// the frequencies only depend on the seed, and are frequencies
+int main(void)
+{
+  const OT::Sample sample(NormalCopulaSample(3, {{0, 1, 0.7}}, 200));
+
+  OTAGRUM::StructureBootstrap bootstrap(sample, 8);
+  bootstrap.setMaximumConditioningSetSize(1);
+  bootstrap.setSeed(42);
+  bootstrap.run();
+  const auto edges = bootstrap.getEdgeFrequencies();
+
+  OTAGRUM::StructureBootstrap other(bootstrap);
+  other.run();
+  if (!Check(edges == other.getEdgeFrequencies(), "not reproducible"))
+    return EXIT_FAILURE;
+
+  for (OT::UnsignedInteger i = 0; i < 3; ++i)
+    for (OT::UnsignedInteger j = 0; j < 3; ++j)
+      if (!Check((edges(i, j) >= 0.0) && (edges(i, j) <= 1.0) &&
+                 (edges(i, j) == edges(j, i)), "invalid frequency " + edges.__str__()))
+        return EXIT_FAILURE;
+  // the strong dependence is always found
+  if (!Check(edges(0, 1) == 1.0, "missing edge " + edges.__str__()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
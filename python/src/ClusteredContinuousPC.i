@@ -0,0 +1,10 @@
+// SWIG file ClusteredContinuousPC.i
+
+%{
+#include "otagrum/ClusteredContinuousPC.hxx"
+%}
+
+%include ClusteredContinuousPC_doc.i
+
+%copyctor OTAGRUM::ClusteredContinuousPC;
+%include "otagrum/ClusteredContinuousPC.hxx"
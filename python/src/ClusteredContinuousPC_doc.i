@@ -0,0 +1,179 @@
+%feature("docstring") OTAGRUM::ClusteredContinuousPC
+"ClusteredContinuousPC learner.
+
+Parameters
+----------
+data : 2-d sequence of float
+    The data
+maxConditioningSetSize : int, optional
+    The maximum conditioning set for independence tests
+alpha : float
+    Hypothesis test threshold
+
+Notes
+-----
+PC algorithm for high dimensional data. The variables are first gathered in
+clusters by decreasing Spearman correlation (single linkage), with at most
+:meth:`getMaximumClusterSize` variables per cluster. Each cluster is extended
+by the :meth:`getOverlapSize` variables outside it the most correlated with
+it. The PC algorithm is run in each cluster, in parallel.
+
+The skeletons of the clusters are merged : an edge is kept if no cluster
+removed it, and a pair of variables never in the same cluster is kept if its
+Spearman correlation is significant. The merged skeleton is then checked by
+:class:`~otagrum.ContinuousPC` on the whole data, starting from it instead of
+the complete graph, which also gives the PDAG, DAG and junction tree. Only the
+edges between clusters and the edges of the variables in the overlaps are
+tested again : the other edges have the same neighbours as in their cluster.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> R = ot.CorrelationMatrix(4)
+>>> R[0, 1] = 0.6
+>>> R[2, 3] = 0.6
+>>> data = ot.NormalCopula(R).getSample(300)
+>>> learner = otagrum.ClusteredContinuousPC(data, 2, 0.1)
+>>> learner.setMaximumClusterSize(2)
+>>> dag = learner.learnDAG()"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::learnSkeleton
+"Learn the skeleton.
+
+Returns
+-------
+skeleton : :py:class:`pyagrum.UndiGraph`
+    The learned skeleton"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::learnPDAG
+"Learn the PDAG.
+
+Returns
+-------
+pdag : :py:class:`pyagrum.MixedGraph`
+    The learned PDAG"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::learnDAG
+"Learn the DAG.
+
+Returns
+-------
+dag : :class:`~otagrum.NamedDAG`
+    The learned DAG"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::learnJunctionTree
+"Learn the junction tree.
+
+Returns
+-------
+jt : :class:`~otagrum.NamedJunctionTree`
+    The learned junction tree"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::setMaximumClusterSize
+"Set the maximum size of the clusters, before their overlap.
+
+Parameters
+----------
+maximumClusterSize : int
+    The maximum number of variables of a cluster. Default is 50."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getMaximumClusterSize
+"Returns the maximum size of the clusters, before their overlap.
+
+Returns
+-------
+maximumClusterSize : int
+    The maximum number of variables of a cluster."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::setOverlapSize
+"Set the number of variables added to each cluster from the others.
+
+Parameters
+----------
+overlapSize : int
+    The number of variables added to each cluster. Default is 5."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getOverlapSize
+"Returns the number of variables added to each cluster from the others.
+
+Returns
+-------
+overlapSize : int
+    The number of variables added to each cluster."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getClustersNumber
+"Returns the number of clusters of the last learning.
+
+Returns
+-------
+n : int
+    The number of clusters."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getCluster
+"Returns a cluster of the last learning, with its overlap.
+
+Parameters
+----------
+i : int
+    The index of the cluster.
+
+Returns
+-------
+cluster : :class:`openturns.Indices`
+    The variables of the cluster."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getContinuousPC
+"Returns the learner checking the merged skeleton on the whole data.
+
+Returns
+-------
+learner : :class:`~otagrum.ContinuousPC`
+    The learner, with the p-values and separators of the edges.
+
+Notes
+-----
+The learner is built by the first learn method called : an exception is
+raised before."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::setVerbosity
+"Set the verbosity.
+
+Parameters
+----------
+verbose : bool
+    Whether to trace the learning."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ClusteredContinuousPC::getVerbosity
+"Returns the verbosity.
+
+Returns
+-------
+verbose : bool
+    Whether the learning is traced."
@@ -5,13 +5,23 @@ Parameters
 ----------
 data : 2-d sequence of float
     The data
+checkpointFile : str, optional
+    A checkpoint file written by a run on the same data (see
+    :meth:`setCheckpointFile`), to resume this run.
 
 Notes
 -----
 MIIC algorithm is a hybrid method between contrained and score based methods.
 It allows one to learn the structure of a bayesian network and consists in three steps :
 skeleton learning, V-structure searching and constraint propagation. These steps
-rely on an information theoretic score."
+rely on an information theoretic score.
+
+The initiation phase evaluates the edges of the complete graph in parallel, by
+batches of `ContinuousMIIC-InitiationBatchSize` edges (see
+:class:`openturns.ResourceMap`); the results do not depend on the batch size.
+The contributor search of an iteration evaluates its candidates in parallel,
+by batches of `ContinuousMIIC-ContributorsBatchSize` candidates sharing one
+local copy of the entropy cache."
 
 // ----------------------------------------------------------------------------
 
@@ -119,7 +129,7 @@ verbose : bool
 Parameters
 ----------
 cmode : CorrectedMutualInformation.CModeTypes
-    Copula model (Gaussian or Bernstein)"
+    Copula model (Gaussian, Bernstein or Histogram)"
 
 // ----------------------------------------------------------------------------
 
@@ -133,6 +143,30 @@ kmode : CorrectedMutualInformation.CModeTypes
 
 // ----------------------------------------------------------------------------
 
+%feature("docstring") OTAGRUM::ContinuousMIIC::setEntropyTolerance
+"Change the tolerance of the subsampled entropies.
+
+Parameters
+----------
+entropyTolerance : float
+    Tolerance of the standard error of the entropies relative to alpha, 0 to
+    use all the points. See
+    :meth:`~otagrum.CorrectedMutualInformation.setEntropyTolerance`. With a
+    positive tolerance, the verbose output gives the standard error of each
+    information."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getEntropyTolerance
+"Accessor to the tolerance of the subsampled entropies.
+
+Returns
+-------
+entropyTolerance : float
+    Tolerance relative to alpha, 0 if all the points are used."
+
+// ----------------------------------------------------------------------------
+
 %feature("docstring") OTAGRUM::ContinuousMIIC::setAlpha
 "Set the alpha correction value of mutual information when using
 the naive KMode.
@@ -155,6 +189,73 @@ alpha : float
 
 // ----------------------------------------------------------------------------
 
+%feature("docstring") OTAGRUM::ContinuousMIIC::setNeighbourContributors
+"Restrict the contributors to the neighbours.
+
+Parameters
+----------
+neighbourContributors : bool
+    Whether the contributors of an edge X-Y searched in the iteration phase
+    are restricted to the current neighbours of X or Y. By default all the
+    other nodes are considered; with this restriction the cost of an
+    iteration follows the density of the graph instead of its dimension."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getNeighbourContributors
+"Accessor to the restriction of the contributors to the neighbours.
+
+Returns
+-------
+neighbourContributors : bool
+    Whether the contributors are restricted to the neighbours."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::setContributorsNumber
+"Limit the number of contributors evaluated for an edge.
+
+Parameters
+----------
+contributorsNumber : int
+    Number of candidates Z of an edge X-Y evaluated in the iteration phase,
+    chosen as the ones with the largest :math:`I(X;Z) + I(Y;Z)` already in the
+    entropy cache. 0 (the default) evaluates all the candidates."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getContributorsNumber
+"Accessor to the number of contributors evaluated for an edge.
+
+Returns
+-------
+contributorsNumber : int
+    Number of candidates evaluated, 0 for all."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::setRankScreening
+"Set whether the edges are screened by their rank correlation.
+
+Parameters
+----------
+rankScreening : bool
+    Whether the edges whose Spearman correlation is negligible, see
+    :class:`~otagrum.RankCorrelationScreening`, are cut with an empty
+    separator before the initiation phase. Default is *False*."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getRankScreening
+"Accessor to the screening of the edges by their rank correlation.
+
+Returns
+-------
+rankScreening : bool
+    Whether the edges are screened by their rank correlation."
+
+// ----------------------------------------------------------------------------
+
 %feature("docstring") OTAGRUM::ContinuousMIIC::addForbiddenArc
 "The arc will not be added in the learned DAG.
 
@@ -196,3 +297,77 @@ tail : str
 Returns
 -------
 vars : sequence of :py:class:`pyagrum.Arc`"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::setCheckpointFile
+"Write checkpoints of the skeleton learning in a file.
+
+The state of the iteration phase (skeleton, separating sets, queue of the
+candidate contributors, constraints and settings) is written after the
+initiation phase and then every `ContinuousMIIC-CheckpointPeriod` iterations
+(see :class:`openturns.ResourceMap`). The learner built from the data and this
+file continues the run exactly.
+
+Parameters
+----------
+fileName : str
+    The checkpoint file, an empty string disables the checkpoints.
+withCache : bool, optional
+    Whether the cached entropies are also written. Default is False."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getCheckpointFile
+"Returns the checkpoint file.
+
+Returns
+-------
+fileName : str
+    The checkpoint file, empty if the checkpoints are disabled."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::setMonitor
+"Set the monitor of the learning.
+
+Parameters
+----------
+monitor : :class:`~otagrum.LearningMonitor`
+    The monitor, called as the learning progresses. It is not copied and must
+    be kept alive during the learning."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::setMaximumWallTime
+"Set the wall-clock budget of the learning.
+
+After this duration, the learning stops and returns the best valid result
+found so far, see :meth:`isInterrupted`.
+
+Parameters
+----------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit.
+    Default is 0."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::getMaximumWallTime
+"Returns the wall-clock budget of the learning.
+
+Returns
+-------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMIIC::isInterrupted
+"Returns whether the last learning has been interrupted.
+
+Returns
+-------
+interrupted : bool
+    Whether the last learning has been stopped by the monitor or by the
+    wall-clock budget before its end."
@@ -0,0 +1,10 @@
+// SWIG file ContinuousMarkovBlanket.i
+
+%{
+#include "otagrum/ContinuousMarkovBlanket.hxx"
+%}
+
+%include ContinuousMarkovBlanket_doc.i
+
+%copyctor OTAGRUM::ContinuousMarkovBlanket;
+%include "otagrum/ContinuousMarkovBlanket.hxx"
@@ -0,0 +1,113 @@
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket
+"ContinuousMarkovBlanket learner.
+
+Parameters
+----------
+data : 2-d sequence of float
+    The data
+maxConditioningSetSize : int, optional
+    The maximum conditioning set for independence tests
+alpha : float
+    Hypothesis test threshold
+
+Notes
+-----
+Learns the Markov blanket (parents, children and spouses) of target variables
+without learning the whole skeleton, with the independence tests of
+:class:`~otagrum.ContinuousTTest`. The parents and children of a target are
+found by the MMPC algorithm : the variable with the strongest minimal
+association with the target is added to the candidates until the others are
+found independent given a subset of the candidates, then the candidates
+independent given a subset of the others are removed. A candidate is kept only
+if the target is also a candidate for it (symmetry correction). A spouse is a
+variable adjacent to a child of the target, forming a v-structure with the
+target.
+
+Apart from one test per variable against the target, the number of tests
+depends on the size of the blankets explored. The results of each variable
+explored are kept for the next targets.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> R = ot.CorrelationMatrix(3)
+>>> R[0, 1] = 0.6
+>>> data = ot.NormalCopula(R).getSample(300)
+>>> learner = otagrum.ContinuousMarkovBlanket(data, 2, 0.1)
+>>> blanket = learner.getMarkovBlanket(0)"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::getParentsAndChildren
+"Returns the parents and children of a target.
+
+Parameters
+----------
+target : int or str
+    The target's id or name
+
+Returns
+-------
+pc : :class:`openturns.Indices` or list of str
+    The parents and children of the target."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::getSpouses
+"Returns the spouses of a target, i.e. the other parents of its children.
+
+Parameters
+----------
+target : int or str
+    The target's id or name
+
+Returns
+-------
+spouses : :class:`openturns.Indices` or list of str
+    The spouses of the target."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::getMarkovBlanket
+"Returns the Markov blanket of a target.
+
+Parameters
+----------
+target : int or str
+    The target's id or name
+
+Returns
+-------
+blanket : :class:`openturns.Indices` or list of str
+    The parents, children and spouses of the target."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::getTestsNumber
+"Returns the number of independence tests done so far.
+
+Returns
+-------
+n : int
+    The number of independence tests."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::setVerbosity
+"Set the verbosity.
+
+Parameters
+----------
+verbose : bool
+    Whether to trace the learning."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousMarkovBlanket::getVerbosity
+"Returns the verbosity.
+
+Returns
+-------
+verbose : bool
+    Whether the learning is traced."
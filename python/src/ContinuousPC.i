@@ -6,5 +6,10 @@
 
 %include ContinuousPC_doc.i
 
+%include std_vector.i
+%template(UndiGraphVector) std::vector<gum::UndiGraph>;
+%template(MixedGraphVector) std::vector<gum::MixedGraph>;
+%template(NamedDAGVector) std::vector<OTAGRUM::NamedDAG>;
+
 %copyctor OTAGRUM::ContinuousPC;
 %include "otagrum/ContinuousPC.hxx"
@@ -9,12 +9,38 @@ maxConditioningSetSize : int, optional
     The maximum conditioning set for independecy test
 alpha : float
     Hypothesis test threshold
+previous : :class:`~otagrum.ContinuousPC`
+    Alternatively, a learner whose skeleton has been learned, to warm start
+    from when new rows are appended to its data.
+newRows : 2-d sequence of float
+    The rows appended to the data of `previous`.
+margin : float
+    The decisions of `previous` whose p-value is within `margin` of alpha are
+    revised : the edges of its skeleton incident to their nodes are tested
+    again on the whole data. The other decisions are kept.
+checkpointFile : str
+    Alternatively, with `data`, a checkpoint file written by a run on the same
+    data (see :meth:`setCheckpointFile`), to resume this run.
 
 Notes
 -----
 PC algorithm is a constrained method allowing to learn the structure of a bayesian
 network. It consists in three steps : skeleton learning, V-structure searching
-and constraint propagation."
+and constraint propagation.
+
+Examples
+--------
+Warm start when new data arrives:
+
+>>> import openturns as ot
+>>> import otagrum
+>>> R = ot.CorrelationMatrix(3)
+>>> R[0, 1] = 0.6
+>>> copula = ot.NormalCopula(R)
+>>> learner = otagrum.ContinuousPC(copula.getSample(300), 2, 0.1)
+>>> skeleton = learner.learnSkeleton()
+>>> updated = otagrum.ContinuousPC(learner, copula.getSample(30), 0.05)
+>>> skeleton = updated.learnSkeleton()"
 
 // ----------------------------------------------------------------------------
 
@@ -256,3 +282,559 @@ Returns
 removed : bool
     Whether the arc x-y has been removed, this is equivalent to x and y
     being independent"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setSeparatorOrdering
+"Change the order in which candidate separators are tested.
+
+Parameters
+----------
+ordering : ContinuousPC.SeparatorOrderingTypes
+    Lexicographic (default) or Heuristic.
+
+Notes
+-----
+For each edge y-z, the PC algorithm stops at the first conditioning set which
+separates y and z. With the Heuristic ordering, the candidate sets are ranked by
+their association with y and z, as measured by the absolute T-test statistics
+computed at the previous levels, so that the most likely separators are tested
+first. The sets holding a node whose association is unknown, such as the nodes
+linked to y or z by a required edge, come last. This reduces the number of tests on dense graphs, but may select another separator
+than the lexicographic ordering."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getSeparatorOrdering
+"Returns the order in which candidate separators are tested.
+
+Returns
+-------
+ordering : ContinuousPC.SeparatorOrderingTypes
+    Lexicographic or Heuristic."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setMaximumTestsPerEdge
+"Set the maximum number of independence tests per edge and per level.
+
+Parameters
+----------
+maximumTests : int
+    Maximum number of candidate separators tested for one edge at a given
+    conditioning set size. 0 (default) means no limit.
+
+Notes
+-----
+When an edge has more candidate separators than this limit, typically when its
+extremities are hubs, the search does not enumerate them all but tests only
+*maximumTests* candidates randomly sampled, tested in the order set by
+:meth:`setSeparatorOrdering`. The sampling is reproducible, see
+:meth:`setSeed`. The edges whose search has been shortened this way are
+reported by :meth:`isCapped` and :meth:`getTrace`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getMaximumTestsPerEdge
+"Returns the maximum number of independence tests per edge and per level.
+
+Returns
+-------
+maximumTests : int
+    Maximum number of tests, 0 means no limit."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setMaximumTimePerEdge
+"Set the maximum time spent searching a separator for one edge at a given level.
+
+Parameters
+----------
+maximumTime : float
+    Maximum time in seconds. 0 (default) means no limit.
+
+Notes
+-----
+When the limit is reached, the search of a separator for this edge stops and
+the edge is kept. It is then reported by :meth:`isCapped`. Note that the
+result depends on the speed of the machine."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getMaximumTimePerEdge
+"Returns the maximum time spent searching a separator for one edge at a given level.
+
+Returns
+-------
+maximumTime : float
+    Maximum time in seconds, 0 means no limit."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setSeed
+"Set the seed used to sample the candidate separators.
+
+Parameters
+----------
+seed : int
+    Seed of the random sampling of separators, see :meth:`setMaximumTestsPerEdge`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getSeed
+"Returns the seed used to sample the candidate separators.
+
+Returns
+-------
+seed : int
+    Seed of the random sampling of separators."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::isCapped
+"Test if the search of a separator for an edge has been cut short by the budget.
+
+Parameters
+----------
+x : str
+    A variable's name
+y : str
+    A variable's name
+x : int
+    A variable's id
+y : int
+    A variable's id
+
+Returns
+-------
+capped : bool
+    Whether the candidate separators of x-y have not all been tested, because
+    of :meth:`setMaximumTestsPerEdge` or :meth:`setMaximumTimePerEdge`"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setGroupedScheduling
+"Run the tests of a level grouped by conditioning set.
+
+The tests sharing the same conditioning set X are run one after the other, so
+that the logPDFs of X, X+y, X+z, X+y+z are computed once and removed from the
+cache as soon as the group is done. This bounds the memory used by the cache
+without changing the learned skeleton. It cannot be combined with the prefetch
+(see :meth:`setPrefetch`) nor with the worker processes (see
+:meth:`setWorkersNumber`) : an exception is raised when both are enabled.
+Default is False.
+
+Parameters
+----------
+grouped : bool
+    Whether the tests are grouped by conditioning set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getGroupedScheduling
+"Returns whether the tests of a level are grouped by conditioning set.
+
+Returns
+-------
+grouped : bool
+    Whether the tests are grouped by conditioning set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setPrefetch
+"Compute the logPDFs of the next level while the current one finishes.
+
+When a fraction `ContinuousPC-PrefetchThreshold` of the edges of a level has
+been tested, the logPDFs needed by the first candidate separators of the next
+level are computed in parallel in the background, the edges the most likely to
+survive (lowest p-value) first. At most `ContinuousPC-MaximumPrefetchSize`
+logPDFs are prefetched (see :class:`openturns.ResourceMap`). The learned
+skeleton does not depend on this option. Default is False.
+
+It cannot be combined with the grouped scheduling (see
+:meth:`setGroupedScheduling`) nor with the worker processes (see
+:meth:`setWorkersNumber`) : an exception is raised when both are enabled.
+
+Parameters
+----------
+prefetch : bool
+    Whether the logPDFs of the next level are prefetched."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getPrefetch
+"Returns whether the logPDFs of the next level are prefetched.
+
+Returns
+-------
+prefetch : bool
+    Whether the logPDFs of the next level are prefetched."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setAlpha
+"Set the threshold of the independence tests.
+
+Parameters
+----------
+alpha : float
+    The threshold of the independence tests.
+
+Notes
+-----
+After a warm start, the decisions kept from the previous run are revised for
+the new threshold : the removed edges whose p-value is below `alpha` are
+tested again, as are the kept edges near them or whose p-value is not below
+`alpha`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getAlpha
+"Returns the threshold of the independence tests.
+
+Returns
+-------
+alpha : float
+    The threshold of the independence tests."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::learnSkeletons
+"Learn the skeleton for several thresholds of the independence tests.
+
+The test statistics do not depend on alpha, so each test is computed once for
+the whole sweep. The results are the same as independent runs, except with a
+time budget per edge (see :meth:`setMaximumTimePerEdge`). The threshold of the
+object is left unchanged.
+
+Parameters
+----------
+alphas : sequence of float
+    The thresholds, sorted in increasing order.
+
+Returns
+-------
+skeletons : sequence of :class:`pyagrum.UndiGraph`
+    The skeleton learned for each alpha."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::learnPDAGs
+"Learn the PDAG for several thresholds of the independence tests.
+
+See :meth:`learnSkeletons`.
+
+Parameters
+----------
+alphas : sequence of float
+    The thresholds, sorted in increasing order.
+
+Returns
+-------
+pdags : sequence of :class:`pyagrum.MixedGraph`
+    The PDAG learned for each alpha."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::learnDAGs
+"Learn the DAG for several thresholds of the independence tests.
+
+See :meth:`learnSkeletons`.
+
+Parameters
+----------
+alphas : sequence of float
+    The thresholds, sorted in increasing order.
+
+Returns
+-------
+dags : sequence of :class:`~otagrum.NamedDAG`
+    The DAG learned for each alpha."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setCheckpointFile
+"Write checkpoints of the skeleton learning in a file.
+
+The state of the skeleton learning (graph, separating sets, p-values, order of
+the removed edges and settings) is written before each size of conditioning
+set. The learner built from the data and this file continues the run exactly.
+
+Parameters
+----------
+fileName : str
+    The checkpoint file, an empty string disables the checkpoints.
+withCache : bool, optional
+    Whether the cached logPDFs are also written. Default is False."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getCheckpointFile
+"Returns the checkpoint file.
+
+Returns
+-------
+fileName : str
+    The checkpoint file, empty if the checkpoints are disabled."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setInitialSkeleton
+"Start the skeleton learning from a given graph.
+
+The edges of the graph are tested as usual, from the empty conditioning set,
+instead of all the pairs of variables. The missing edges are considered
+removed, see :meth:`setInitialSepset`.
+
+Parameters
+----------
+skeleton : :class:`pyagrum.UndiGraph`
+    The initial skeleton, with one node per variable."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setInitialSepset
+"Set the separator of an edge missing in the initial skeleton.
+
+Only the missing edges with a separator are used to orient v-structures.
+
+Parameters
+----------
+x : int
+    A variable's id
+y : int
+    A variable's id
+sepset : sequence of int
+    The separator of x and y.
+pValue : float
+    The p-value of the test of x and y given the separator."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::addFrozenEdge
+"Keep an edge of the initial skeleton without testing it.
+
+This is sound when the neighbours of x and y are the ones of a previous run
+which kept the edge, see :class:`~otagrum.ClusteredContinuousPC`.
+
+Parameters
+----------
+x : int
+    A variable's id
+y : int
+    A variable's id
+pValue : float
+    The largest p-value of the tests of x and y in the previous run."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::addForbiddenEdge
+"Forbid an edge of the skeleton.
+
+The edge is removed before the tests, without separator.
+
+Parameters
+----------
+x : int or str
+    A variable's id or name
+y : int or str
+    A variable's id or name"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::addRequiredEdge
+"Require an edge of the skeleton.
+
+The edge is never tested, and its nodes can still separate other edges.
+
+Parameters
+----------
+x : int or str
+    A variable's id or name
+y : int or str
+    A variable's id or name"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setTiers
+"Set the tiers of the variables.
+
+No arc can go from a tier to a lower one : the edges between two tiers are
+oriented from the lower tier before the v-structures, and the separators of
+two variables are only searched among the variables whose tier is not higher
+than both of theirs.
+
+Parameters
+----------
+tiers : sequence of int
+    The tier of each variable, or an empty sequence to remove the tiers.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> data = ot.Normal(3).getSample(100)
+>>> learner = otagrum.ContinuousPC(data)
+>>> learner.setTiers([0, 0, 1])"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getTiers
+"Returns the tiers of the variables.
+
+Returns
+-------
+tiers : :class:`openturns.Indices`
+    The tier of each variable, empty if no tier has been set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setHighDimension
+"Set the high-dimension mode.
+
+In this mode, the pairs of variables are tested with the empty conditioning
+set without building the complete graph, and the results of these tests are
+kept in flat arrays instead of per-edge tables. The learned graphs are the
+same, but the pairs removed by these tests are not listed by :meth:`getTrace`.
+This mode cannot be combined with checkpoints or warm starts.
+
+Parameters
+----------
+highDimension : bool
+    Whether to use the high-dimension mode. Default is False."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getHighDimension
+"Returns whether the high-dimension mode is used.
+
+Returns
+-------
+highDimension : bool
+    Whether the high-dimension mode is used."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setRankScreening
+"Set whether the pairs are screened by their rank correlation.
+
+Parameters
+----------
+rankScreening : bool
+    Whether the pairs of variables whose Spearman correlation is negligible,
+    see :class:`~otagrum.RankCorrelationScreening`, are removed with an empty
+    separator before any test. Default is *False*.
+
+Notes
+-----
+Only the remaining pairs are tested, which saves most of the tests of size 0
+on data with thousands of variables. A dependence without monotone trend may
+be missed."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getRankScreening
+"Returns whether the pairs are screened by their rank correlation.
+
+Returns
+-------
+rankScreening : bool
+    Whether the pairs are screened by their rank correlation."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setWorkersNumber
+"Set the number of worker processes.
+
+The search of the separators of each level is spread over local worker
+processes, forked at the beginning of the level : they read the data and the
+cache of the learner without copying them, and are not limited by the Python
+GIL. The logPDFs computed by a worker stay in its own cache, for the next edges
+it receives in the level, and are not returned to the learner. The edges are
+sent to the workers by batches of `ContinuousPC-WorkersBatchSize` (see
+:class:`openturns.ResourceMap`), and the results are merged in the order of the
+edges, hence they do not depend on the number of workers. This mode cannot be
+combined with the grouped scheduling nor with the prefetch : an exception is
+raised when both are enabled. Only available on Linux.
+
+A process cannot be safely forked while other threads run : the TBB thread
+pool must be limited to one thread with :meth:`openturns.TBB.SetThreadsNumber`
+before the workers are enabled, otherwise an exception is raised.
+
+Parameters
+----------
+workersNumber : int
+    The number of worker processes, 0 to test in the current process.
+    Default is 0."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getWorkersNumber
+"Returns the number of worker processes.
+
+Returns
+-------
+workersNumber : int
+    The number of worker processes, 0 if the tests are run in the current
+    process."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setMonitor
+"Set the monitor of the learning.
+
+Parameters
+----------
+monitor : :class:`~otagrum.LearningMonitor`
+    The monitor, called as the learning progresses. It is not copied and must
+    be kept alive during the learning."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::setMaximumWallTime
+"Set the wall-clock budget of the learning.
+
+After this duration, the learning stops and returns the best valid result
+found so far, see :meth:`isInterrupted`.
+
+Parameters
+----------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit.
+    Default is 0."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getMaximumWallTime
+"Returns the wall-clock budget of the learning.
+
+Returns
+-------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::isInterrupted
+"Returns whether the last learning has been interrupted.
+
+Returns
+-------
+interrupted : bool
+    Whether the last learning has been stopped by the monitor or by the
+    wall-clock budget before its end.
+
+Notes
+-----
+An interrupted result is not kept by the learner : the next call to a learn
+method learns it again."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousPC::getTestsNumber
+"Returns the number of independence tests of the last learning.
+
+Returns
+-------
+testsNumber : int
+    The number of independence tests."
@@ -14,5 +14,10 @@
 
 %include ContinuousTTest_doc.i
 
+%ignore OTAGRUM::ContinuousTTest::computeLogPDFs;
+%ignore OTAGRUM::ContinuousTTest::storeLogPDFs;
+%ignore OTAGRUM::ContinuousTTest::writeCache;
+%ignore OTAGRUM::ContinuousTTest::readCache;
+
 %copyctor OTAGRUM::ContinuousTTest;
 %include "otagrum/ContinuousTTest.hxx"
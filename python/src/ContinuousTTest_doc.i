@@ -26,6 +26,71 @@ level : int
 
 // ----------------------------------------------------------------------------
 
+%feature("docstring") OTAGRUM::ContinuousTTest::releaseLogPDFs
+"Remove from the cache the logPDFs used by the test of Y and Z given X.
+
+Parameters
+----------
+Y : int
+    The first variable of the test.
+Z : int
+    The second variable of the test.
+X : sequence of int
+    The conditioning set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousTTest::computeLogPDF
+"Compute the logPDF of the empirical Bernstein copula of a set of variables.
+
+The cache is neither read nor updated.
+
+Parameters
+----------
+l : sequence of int
+    The set of variables.
+k : int
+    The bin number of the copula.
+
+Returns
+-------
+logPDF : :class:`openturns.Point`
+    The logPDF at each point of the data set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousTTest::isCached
+"Test if the logPDF of a set of variables is in the cache.
+
+Parameters
+----------
+l : sequence of int
+    The set of variables.
+k : int
+    The bin number of the copula.
+
+Returns
+-------
+cached : bool
+    Whether the logPDF does not need to be computed."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::ContinuousTTest::getK
+"Return the bin number used by the tests for a conditioning set size.
+
+Parameters
+----------
+conditioningSize : int
+    The size of the conditioning set.
+
+Returns
+-------
+k : int
+    The bin number of the copulae."
+
+// ----------------------------------------------------------------------------
+
 %feature("docstring") OTAGRUM::ContinuousTTest::getDimension
 "Return the dimension of the underlying data set.
 
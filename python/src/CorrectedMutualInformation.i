@@ -7,5 +7,10 @@
 
 %include CorrectedMutualInformation_doc.i
 
+%ignore OTAGRUM::CorrectedMutualInformation::writeCaches;
+%ignore OTAGRUM::CorrectedMutualInformation::readCaches;
+%ignore OTAGRUM::CorrectedMutualInformation::getLocalCopy;
+%ignore OTAGRUM::CorrectedMutualInformation::mergeCaches;
+
 %copyctor OTAGRUM::CorrectedMutualInformation;
 %include "otagrum/CorrectedMutualInformation.hxx"
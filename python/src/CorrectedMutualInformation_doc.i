@@ -115,6 +115,55 @@ I(X;Y;Z|U) = I(X;Y|U) - I(X;Y|U,Z)."
 
 // ----------------------------------------------------------------------------
 
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::compute3PtCorrectedInformations
+"Return the corrected three-point informations between X, Y and each of
+several variables Z conditionally to the variable set U (possibly empty).
+
+Parameters
+----------
+X : int
+    X node id.
+Y : int
+    Y node id.
+Zs : list
+    List of the Z node ids.
+U : list
+    List of node ids in the (possibly empty) set U
+
+Returns
+-------
+infos : :class:`~openturns.Point`
+    The corrected three-point informations I'(X;Y;Z|U) of each Z.
+
+Notes
+-----
+The values are those of :meth:`compute3PtCorrectedInformation`, but the
+entropies which do not depend on Z are computed once for all the Z. The Z
+with the largest information is given by :meth:`getBest3PtContributor`.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> ot.RandomGenerator.SetSeed(0)
+>>> sample = ot.Normal(4).getSample(100)
+>>> info = otagrum.CorrectedMutualInformation(sample)
+>>> infos = info.compute3PtCorrectedInformations(0, 1, [2, 3])
+>>> best = info.getBest3PtContributor()"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::getBest3PtContributor
+"Accessor to the best Z of the last batch of three-point informations.
+
+Returns
+-------
+Z : int
+    The Z with the largest information computed by the last call to
+    :meth:`compute3PtCorrectedInformations`, the first one in case of ties."
+
+// ----------------------------------------------------------------------------
+
 %feature("docstring") OTAGRUM::CorrectedMutualInformation::clearCaches
 "Clear cache containing the cross-entropies that are used to compute mutual information."
 
@@ -136,4 +185,113 @@ kmode : CorrectedMutualInformation.KModeTypes
 Parameters
 ----------
 cmode : CorrectedMutualInformation.CModeTypes
-    Copula model (Gaussian or Bernstein)."
+    Copula model (Gaussian, Bernstein or Histogram).
+
+Notes
+-----
+In the Gaussian mode, the entropy of the normal copula fitted on a set of
+variables :math:`S` is computed in closed form as
+
+.. math::
+
+    H_S = \frac{1}{2} \log \det R_S + \frac{1}{2} \operatorname{tr}((R_S^{-1} - I) M_S)
+
+where :math:`R_S` is the fitted correlation and :math:`M_S` the empirical
+second moment of the normal scores. Both are built from values computed once
+per pair of variables, so the data are only read once per pair.
+
+In the Histogram mode, the copula density is estimated by the frequencies of
+the cells of a regular grid with :math:`K` bins per variable in rank space,
+:math:`K` growing with the sample size as for the Bernstein copula. Only the
+occupied cells are counted, so the cost is linear in the sample size instead
+of quadratic for the Bernstein copula, while the dependence is not assumed
+Gaussian. See :meth:`setMillerMadowCorrection`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::setMillerMadowCorrection
+"Change the bias correction of the Histogram mode.
+
+Parameters
+----------
+millerMadowCorrection : bool
+    Whether :math:`(m - 1) / (2N)` is added to the entropies, with :math:`m`
+    the number of occupied cells and :math:`N` the sample size. The default
+    is given by the `CorrectedMutualInformation-MillerMadowCorrection` key of
+    :class:`openturns.ResourceMap`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::getMillerMadowCorrection
+"Accessor to the bias correction of the Histogram mode.
+
+Returns
+-------
+millerMadowCorrection : bool
+    Whether the Miller-Madow correction is added to the entropies."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::setUseEntropyStore
+"Share the entropies through the :class:`~otagrum.EntropyStore`.
+
+Parameters
+----------
+useEntropyStore : bool
+    Whether the entropies are kept in the process-wide store shared by the
+    instances built on the same data, instead of a private cache. The
+    default is given by the `CorrectedMutualInformation-UseEntropyStore` key
+    of :class:`openturns.ResourceMap`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::getUseEntropyStore
+"Accessor to the use of the :class:`~otagrum.EntropyStore`.
+
+Returns
+-------
+useEntropyStore : bool
+    Whether the entropies are kept in the process-wide store."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::setEntropyTolerance
+"Change the tolerance of the subsampled entropies.
+
+Parameters
+----------
+entropyTolerance : float
+    The entropy of the Bernstein copula is the mean of its log-density over
+    the sample. With a positive tolerance, this mean is estimated on a random
+    subset of points, doubled until its standard error is below
+    `entropyTolerance` times alpha, the penalty of the Naive mode. A value of
+    0 uses all the points. The default is given by the
+    `CorrectedMutualInformation-EntropyTolerance` key of
+    :class:`openturns.ResourceMap`, and the size of the first subset by the
+    `CorrectedMutualInformation-EntropySubsampleSize` key.
+
+Notes
+-----
+The subsets are drawn once from the OpenTURNS random generator when a
+positive tolerance is set."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::getEntropyTolerance
+"Accessor to the tolerance of the subsampled entropies.
+
+Returns
+-------
+entropyTolerance : float
+    Tolerance relative to alpha, 0 if all the points are used."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::CorrectedMutualInformation::getInformationStandardError
+"Accessor to the standard error of the last information computed.
+
+Returns
+-------
+standardError : float
+    Standard error of the last 2-point or 3-point information due to the
+    subsampling of its entropies, 0 if they are all exact."
@@ -0,0 +1,12 @@
+// SWIG file EntropyStore.i
+
+%{
+#include "otagrum/EntropyStore.hxx"
+%}
+
+%include EntropyStore_doc.i
+
+%ignore OTAGRUM::EntropyStore::Get;
+%ignore OTAGRUM::EntropyStore::Set;
+
+%include "otagrum/EntropyStore.hxx"
@@ -0,0 +1,75 @@
+%feature("docstring") OTAGRUM::EntropyStore
+"Process-wide store of the copula entropies.
+
+Notes
+-----
+The instances of :class:`~otagrum.CorrectedMutualInformation`, and so the
+:class:`~otagrum.ContinuousMIIC` and :class:`~otagrum.TabuList` learners,
+built while the `CorrectedMutualInformation-UseEntropyStore` key of
+:class:`openturns.ResourceMap` is set keep their entropies in this store
+instead of a private cache. The entries are keyed by a fingerprint of the
+data, the copula model and the set of variables, so the learners working on
+the same sample compute each entropy once.
+
+At most `EntropyStore-MaximumSize` entries are kept, the least recently used
+ones being evicted first. The store can be used by several threads.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> ot.ResourceMap.SetAsBool('CorrectedMutualInformation-UseEntropyStore', True)
+>>> otagrum.EntropyStore.Clear()
+>>> ot.ResourceMap.SetAsBool('CorrectedMutualInformation-UseEntropyStore', False)"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::EntropyStore::Clear
+"Remove all the entries."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::EntropyStore::GetSize
+"Accessor to the number of entries.
+
+Returns
+-------
+size : int
+    Number of entropies in the store."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::EntropyStore::SetMaximumSize
+"Set the maximum number of entries.
+
+Parameters
+----------
+maximumSize : int
+    Maximum number of entropies kept; the least recently used ones are
+    evicted. The default is given by the `EntropyStore-MaximumSize` key of
+    :class:`openturns.ResourceMap`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::EntropyStore::GetMaximumSize
+"Accessor to the maximum number of entries.
+
+Returns
+-------
+maximumSize : int
+    Maximum number of entropies kept."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::EntropyStore::GetFingerprint
+"Fingerprint of a sample.
+
+Parameters
+----------
+sample : 2-d sequence of float
+    The data.
+
+Returns
+-------
+fingerprint : str
+    Hash of the size, the dimension and the values of the sample."
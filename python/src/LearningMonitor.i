@@ -0,0 +1,13 @@
+// SWIG file LearningMonitor.i
+
+%{
+#include "otagrum/LearningMonitor.hxx"
+%}
+
+%include LearningMonitor_doc.i
+
+// allows one to derive the monitor in Python
+%feature("director") OTAGRUM::LearningMonitor;
+
+%ignore OTAGRUM::LearningControl;
+%include "otagrum/LearningMonitor.hxx"
@@ -0,0 +1,57 @@
+%feature("docstring") OTAGRUM::LearningMonitor
+"Monitor of the progress of a structure learning.
+
+Notes
+-----
+The learners :class:`~otagrum.ContinuousPC`, :class:`~otagrum.ContinuousMIIC`
+and :class:`~otagrum.TabuList` call the :meth:`update` method of their monitor
+(see their `setMonitor` method) as they progress. Derive this class and
+override :meth:`update` to follow the learning, or to stop it : the learner
+then returns the best valid result found so far, and its `isInterrupted`
+method returns True.
+
+The monitor is not copied by the learner, it must be kept alive during the
+learning.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> class Stopper(otagrum.LearningMonitor):
+...     def __init__(self, maximumTests):
+...         super(Stopper, self).__init__()
+...         self.maximumTests = maximumTests
+...     def update(self, phase, level, remaining, testsNumber):
+...         return testsNumber >= self.maximumTests
+>>> data = ot.Normal(4).getSample(100)
+>>> learner = otagrum.ContinuousPC(data)
+>>> monitor = Stopper(3)
+>>> learner.setMonitor(monitor)
+>>> skeleton = learner.learnSkeleton()
+>>> learner.isInterrupted()
+True"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::LearningMonitor::update
+"Report the progress of the learning.
+
+Parameters
+----------
+phase : str
+    The phase of the learning : 'skeleton' for ContinuousPC, 'initiation',
+    'iteration' or 'orientation' for ContinuousMIIC, 'tabu' for TabuList.
+level : int
+    The size of the conditioning sets for ContinuousPC, the number of
+    iterations for ContinuousMIIC, the run for TabuList.
+remaining : int
+    The number of edges, groups of tests, triples or runs left in the phase.
+testsNumber : int
+    The work done so far : the number of independence tests for ContinuousPC,
+    of 2-point and 3-point information computations for ContinuousMIIC, of
+    score variations for TabuList.
+
+Returns
+-------
+stop : bool
+    Whether to stop the learning. The default implementation returns False."
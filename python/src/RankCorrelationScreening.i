@@ -0,0 +1,10 @@
+// SWIG file RankCorrelationScreening.i
+
+%{
+#include "otagrum/RankCorrelationScreening.hxx"
+%}
+
+%include RankCorrelationScreening_doc.i
+
+%copyctor OTAGRUM::RankCorrelationScreening;
+%include "otagrum/RankCorrelationScreening.hxx"
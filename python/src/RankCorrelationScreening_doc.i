@@ -0,0 +1,103 @@
+%feature("docstring") OTAGRUM::RankCorrelationScreening
+"Screening of the pairs of variables by their rank correlation.
+
+Parameters
+----------
+data : 2-d sequence of float
+    The data, with at least 3 observations.
+
+Notes
+-----
+The Spearman correlation :math:`\rho` of all the pairs of variables is
+computed by products of blocks of the standardized ranks. Under
+independence, :math:`\sqrt{N - 1} \rho` is asymptotically standard normal,
+and the pairs whose p-value is larger than the threshold are removed from
+the complete graph. The threshold is conservative by default (0.5), so that
+only the clearly negligible pairs are removed. A dependence without monotone
+trend has a null rank correlation and its pair may be removed.
+
+The skeleton can be given to the learners, see the `setRankScreening`
+methods of :class:`~otagrum.ContinuousPC` and
+:class:`~otagrum.ContinuousMIIC`.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> ot.RandomGenerator.SetSeed(0)
+>>> sample = ot.Normal(5).getSample(100)
+>>> screening = otagrum.RankCorrelationScreening(sample)
+>>> skeleton = screening.computeSkeleton()"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::RankCorrelationScreening::setPValueThreshold
+"Set the p-value threshold.
+
+Parameters
+----------
+pValueThreshold : float
+    A pair is removed if the p-value of its Spearman correlation is larger.
+    The default is given by the `RankCorrelationScreening-PValueThreshold`
+    key of :class:`openturns.ResourceMap`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::RankCorrelationScreening::getPValueThreshold
+"Accessor to the p-value threshold.
+
+Returns
+-------
+pValueThreshold : float
+    A pair is removed if the p-value of its Spearman correlation is larger."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::RankCorrelationScreening::computeSkeleton
+"Compute the screened skeleton.
+
+Returns
+-------
+skeleton : :py:class:`pyagrum.UndiGraph`
+    The complete graph on the variables without the removed pairs.
+
+Notes
+-----
+The variables are processed by blocks of `RankCorrelationScreening-BlockSize`
+variables of :class:`openturns.ResourceMap`, so that only the correlations of
+two blocks are stored at a time."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::RankCorrelationScreening::getPValue
+"Accessor to the p-value of a pair.
+
+Parameters
+----------
+x : int
+    First node id.
+y : int
+    Second node id.
+
+Returns
+-------
+pValue : float
+    The p-value of the Spearman correlation of x and y, computed by
+    :meth:`computeSkeleton`."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::RankCorrelationScreening::isRemoved
+"Whether a pair is removed by the screening.
+
+Parameters
+----------
+x : int
+    First node id.
+y : int
+    Second node id.
+
+Returns
+-------
+removed : bool
+    Whether the p-value of x and y is larger than the threshold."
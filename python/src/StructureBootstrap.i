@@ -0,0 +1,10 @@
+// SWIG file StructureBootstrap.i
+
+%{
+#include "otagrum/StructureBootstrap.hxx"
+%}
+
+%include StructureBootstrap_doc.i
+
+%copyctor OTAGRUM::StructureBootstrap;
+%include "otagrum/StructureBootstrap.hxx"
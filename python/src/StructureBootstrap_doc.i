@@ -0,0 +1,223 @@
+%feature("docstring") OTAGRUM::StructureBootstrap
+"Bootstrap of structure learning.
+
+Learns the structure of the data resampled with replacement several times, in
+parallel, and gives for each edge and arc the frequency of its appearance.
+
+Parameters
+----------
+data : 2-d sequence of float
+    The data
+bootstrapSize : int, optional
+    The number of resamples. Default is 100.
+learner : int, optional
+    The learning algorithm, *StructureBootstrap.LearnerTypes_PC* (default) or
+    *StructureBootstrap.LearnerTypes_MIIC*.
+
+Notes
+-----
+Each learner switches its resample to the rank space. The rows of the
+replicate `b` are drawn with a random stream seeded from the seed and `b`, so
+that the results do not depend on the number of threads.
+
+Examples
+--------
+>>> import openturns as ot
+>>> import otagrum
+>>> R = ot.CorrelationMatrix(3)
+>>> R[0, 1] = 0.6
+>>> data = ot.NormalCopula(R).getSample(200)
+>>> bootstrap = otagrum.StructureBootstrap(data, 10)
+>>> bootstrap.setMaximumConditioningSetSize(1)
+>>> bootstrap.run()
+>>> frequencies = bootstrap.getEdgeFrequencies()"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::run
+"Learn the structures of all the resamples."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getEdgeFrequencies
+"Returns the frequencies of the edges in the skeletons.
+
+Returns
+-------
+frequencies : :class:`openturns.SquareMatrix`
+    The symmetric matrix of the frequencies of the edges."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getArcFrequencies
+"Returns the frequencies of the arcs in the PDAGs.
+
+Only the orientations found in the PDAGs are counted, not the arbitrary ones
+of the DAGs.
+
+Returns
+-------
+frequencies : :class:`openturns.SquareMatrix`
+    The frequency of the arc i->j is at row i and column j."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getEdgeFrequency
+"Returns the frequency of an edge in the skeletons.
+
+Parameters
+----------
+x : str
+    A variable's name
+y : str
+    A variable's name
+
+Returns
+-------
+frequency : float
+    The frequency of the edge x-y."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getArcFrequency
+"Returns the frequency of an arc in the PDAGs.
+
+Parameters
+----------
+x : str
+    The tail's name
+y : str
+    The head's name
+
+Returns
+-------
+frequency : float
+    The frequency of the arc x->y."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getResampleIndices
+"Returns the rows of the data drawn for a replicate.
+
+Parameters
+----------
+b : int
+    The index of the replicate.
+
+Returns
+-------
+indices : :class:`openturns.Indices`
+    The rows of the data in the resample."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::setBootstrapSize
+"Set the number of resamples.
+
+Parameters
+----------
+bootstrapSize : int
+    The number of resamples."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getBootstrapSize
+"Returns the number of resamples.
+
+Returns
+-------
+bootstrapSize : int
+    The number of resamples."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::setLearner
+"Set the learning algorithm.
+
+The threshold is reset to the default of the algorithm (0.1 for PC, 0.01 for
+MIIC).
+
+Parameters
+----------
+learner : int
+    *StructureBootstrap.LearnerTypes_PC* or *StructureBootstrap.LearnerTypes_MIIC*."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getLearner
+"Returns the learning algorithm.
+
+Returns
+-------
+learner : int
+    *StructureBootstrap.LearnerTypes_PC* or *StructureBootstrap.LearnerTypes_MIIC*."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::setMaximumConditioningSetSize
+"Set the maximum size of the conditioning sets of the PC algorithm.
+
+Parameters
+----------
+maxCondSet : int
+    The maximum size of the conditioning sets. Default is 5."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getMaximumConditioningSetSize
+"Returns the maximum size of the conditioning sets of the PC algorithm.
+
+Returns
+-------
+maxCondSet : int
+    The maximum size of the conditioning sets."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::setAlpha
+"Set the threshold of the learning algorithm.
+
+Parameters
+----------
+alpha : float
+    The threshold."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getAlpha
+"Returns the threshold of the learning algorithm.
+
+Returns
+-------
+alpha : float
+    The threshold."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::setSeed
+"Set the seed of the resampling.
+
+Parameters
+----------
+seed : int
+    The seed."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getSeed
+"Returns the seed of the resampling.
+
+Returns
+-------
+seed : int
+    The seed."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::StructureBootstrap::getDescription
+"Returns the names of the variables.
+
+Returns
+-------
+description : :class:`openturns.Description`
+    The names of the variables."
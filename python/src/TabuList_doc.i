@@ -89,9 +89,55 @@ score : double
 // ----------------------------------------------------------------------------
 
 %feature("docstring") OTAGRUM::TabuList::setCMode
-"Changes the copula model (Bernstein or Gaussian) used for computing the BIC score.
+"Changes the copula model (Bernstein, Gaussian or Histogram) used for computing the BIC score.
 
 Returns
 -------
 verbose : CorrectedMutualInformation.CModeTypes
-    Copula model (Gaussian or Bernstein)"
+    Copula model (Gaussian, Bernstein or Histogram)"
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::TabuList::setMonitor
+"Set the monitor of the learning.
+
+Parameters
+----------
+monitor : :class:`~otagrum.LearningMonitor`
+    The monitor, called as the learning progresses. It is not copied and must
+    be kept alive during the learning."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::TabuList::setMaximumWallTime
+"Set the wall-clock budget of the learning.
+
+After this duration, the learning stops and returns the best valid result
+found so far, see :meth:`isInterrupted`.
+
+Parameters
+----------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit.
+    Default is 0."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::TabuList::getMaximumWallTime
+"Returns the wall-clock budget of the learning.
+
+Returns
+-------
+maximumWallTime : float
+    The maximum duration of the learning in seconds, 0 for no limit."
+
+// ----------------------------------------------------------------------------
+
+%feature("docstring") OTAGRUM::TabuList::isInterrupted
+"Returns whether the last learning has been interrupted.
+
+Returns
+-------
+interrupted : bool
+    Whether the last learning has been stopped by the monitor or by the
+    wall-clock budget before its end."
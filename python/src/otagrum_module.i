@@ -1,6 +1,6 @@
 // SWIG file otagrum_module.i
 
-%module(docstring="otagr module") otagrum
+%module(docstring="otagr module", directors="1") otagrum
 
 %{
 #include <openturns/OT.hxx>
@@ -29,9 +29,15 @@
 %include JunctionTreeBernsteinCopula.i
 %include JunctionTreeBernsteinCopulaFactory.i
 %include ContinuousTTest.i
+%include LearningMonitor.i
 %include ContinuousPC.i
+%include ClusteredContinuousPC.i
 %include CorrectedMutualInformation.i
+%include EntropyStore.i
+%include RankCorrelationScreening.i
 %include ContinuousMIIC.i
+%include ContinuousMarkovBlanket.i
 %include TabuList.i
+%include StructureBootstrap.i
 %include ContinuousBayesianNetwork.i
 %include ContinuousBayesianNetworkFactory.i
@@ -0,0 +1,38 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import otagrum
+
+# the graphs of an alpha sweep are the ones of independent runs
+ot.RandomGenerator.SetSeed(0)
+R = ot.CorrelationMatrix(4)
+R[0, 1] = 0.6
+R[1, 2] = 0.5
+R[2, 3] = 0.4
+data = ot.NormalCopula(R).getSample(500)
+alphas = [0.01, 0.1, 0.5]
+
+sweeper = otagrum.ContinuousPC(data, 2, 0.2)
+skeletons = sweeper.learnSkeletons(alphas)
+pdags = sweeper.learnPDAGs(alphas)
+dags = sweeper.learnDAGs(alphas)
+assert sweeper.getAlpha() == 0.2, "alpha not restored"
+assert len(skeletons) == len(alphas), "wrong number of skeletons"
+assert len(pdags) == len(alphas), "wrong number of PDAGs"
+assert len(dags) == len(alphas), "wrong number of DAGs"
+
+for alpha, skel, pdag, dag in zip(alphas, skeletons, pdags, dags):
+    learner = otagrum.ContinuousPC(data, 2, alpha)
+    assert skel.edges() == learner.learnSkeleton().edges(), "skeleton %g" % alpha
+    assert pdag.arcs() == learner.learnPDAG().arcs(), "PDAG %g" % alpha
+    assert pdag.edges() == learner.learnPDAG().edges(), "PDAG %g" % alpha
+    assert dag.toDot() == learner.learnDAG().toDot(), "DAG %g" % alpha
+
+# unsorted alphas are rejected and leave the learner usable
+try:
+    sweeper.learnSkeletons([0.5, 0.1])
+    raise AssertionError("unsorted alphas accepted")
+except Exception as e:
+    assert not isinstance(e, AssertionError), e
+reference = otagrum.ContinuousPC(data, 2, 0.2)
+assert sweeper.learnSkeleton().edges() == reference.learnSkeleton().edges()
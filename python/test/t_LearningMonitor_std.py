@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+
+import openturns as ot
+import otagrum
+
+
+# stops the learning after a number of calls
+class Stopper(otagrum.LearningMonitor):
+    def __init__(self, maximumCalls):
+        super(Stopper, self).__init__()
+        self.maximumCalls = maximumCalls
+        self.calls = 0
+        self.phases = set()
+
+    def update(self, phase, level, remaining, testsNumber):
+        self.calls += 1
+        self.phases.add(phase)
+        return self.calls > self.maximumCalls
+
+
+ot.RandomGenerator.SetSeed(0)
+R = ot.CorrelationMatrix(4)
+R[0, 1] = 0.6
+R[1, 2] = 0.5
+R[2, 3] = 0.4
+data = ot.NormalCopula(R).getSample(300)
+
+# the Python monitor is called and stops ContinuousPC
+reference = otagrum.ContinuousPC(data, 2, 0.1).learnSkeleton()
+monitor = Stopper(3)
+learner = otagrum.ContinuousPC(data, 2, 0.1)
+learner.setMonitor(monitor)
+skel = learner.learnSkeleton()
+assert learner.isInterrupted(), "ContinuousPC not interrupted"
+assert monitor.phases == {"skeleton"}, monitor.phases
+for edge in reference.edges():
+    assert skel.existsEdge(*edge), "edge %s removed" % str(edge)
+
+# the interrupted skeleton is not kept
+learner.setMonitor(None)
+assert learner.learnSkeleton().edges() == reference.edges()
+assert not learner.isInterrupted(), "ContinuousPC interrupted"
+
+# a monitor that never stops leaves the result unchanged
+monitor = Stopper(10**9)
+learner = otagrum.ContinuousMIIC(data)
+learner.setMonitor(monitor)
+dag = learner.learnDAG()
+assert not learner.isInterrupted(), "ContinuousMIIC interrupted"
+assert monitor.calls > 0, "monitor of ContinuousMIIC not called"
+assert dag.toDot() == otagrum.ContinuousMIIC(data).learnDAG().toDot()
+
+monitor = Stopper(0)
+learner = otagrum.TabuList(data, 2, 3, 2)
+learner.setMonitor(monitor)
+learner.learnDAG()
+assert learner.isInterrupted(), "TabuList not interrupted"